@@ -50,6 +50,11 @@
     extern uint32_t SystemCoreClock;
     extern void init_run_time_timer(void);
     extern uint32_t get_run_time_count (void);
+    extern void arm_run_time_alarm (uint32_t counts);
+    extern void disarm_run_time_alarm (void);
+    extern uint32_t compare_digest_crc_update (uint32_t digest,
+                                               const void * p_data,
+                                               size_t length);
 #endif
 
 #define configUSE_PREEMPTION                     1
@@ -76,9 +81,25 @@
 
 /* Software timer definitions. */
 #define configUSE_TIMERS                         1
-#define configTIMER_TASK_PRIORITY                ( configMAX_PRIORITIES - 1 )
+#define configTIMER_TASK_PRIORITY                ( configMAX_PRIORITIES - 2 )
 #define configTIMER_QUEUE_LENGTH                 10
 #define configTIMER_TASK_STACK_DEPTH             256
+/* Timers of timed tasks are processed by a second timer service task above
+the one of the application timers. */
+#define configTIMER_SERVICE_LANES                2
+#define configTIMER_LANE_PRIORITIES              { configTIMER_TASK_PRIORITY, ( configMAX_PRIORITIES - 1 ) }
+#define configTIMER_KERNEL_LANE                  1
+/* Commands are sent to the timer service task through a ring instead of a
+queue, where redundant resets and pause/resume pairs are merged. */
+#define configUSE_TIMER_COMMAND_RING             1
+#define configUSE_TIMER_COMMAND_COALESCING       1
+/* Active timers are stored in a hierarchical timing wheel with 16 slots per
+level instead of a sorted list. */
+#define configUSE_TIMER_WHEEL                    1
+#define configTIMER_WHEEL_SLOT_BITS              4
+/* Timers can be given slack, so the timer service task handles the ones that
+expire close together in one wakeup. */
+#define configUSE_TIMER_SLACK                    1
 
 /* Tracing defines */
 #ifndef NDEBUG
@@ -88,6 +109,15 @@
 #   define configRECORD_STACK_HIGH_ADDRESS             1
 #   define portCONFIGURE_TIMER_FOR_RUN_TIME_STATS      init_run_time_timer
 #   define portGET_RUN_TIME_COUNTER_VALUE              get_run_time_count
+#   define configRUN_TIME_COUNTER_HZ                   1000000
+/* Overrun time of timed tasks is counted by the run time counter and expires
+on its compare interrupt, so overruns shorter than a tick are detected. */
+#   define configTIMED_BUDGET_IN_RUN_TIME_COUNTS       1
+#   define configTIMED_BUDGET_ARM                     arm_run_time_alarm
+#   define configTIMED_BUDGET_DISARM                  disarm_run_time_alarm
+/* Histogram of job execution times of timed tasks, see xTaskGetTimedStats(). */
+#   define configUSE_TIMED_TASK_STATS                  1
+#   define configTIMED_TASK_STATS_BUCKETS              16
 #endif
 
 /* Set the following definitions to 1 to include the API function, or zero
@@ -104,6 +134,29 @@ to exclude the API function. */
 #define INCLUDE_xTaskCreateTimed            1
 #define INCLUDE_xTaskCreateReplicated       1
 
+/* Timed task definitions. Timed tasks of priority 6 are scheduled earliest
+deadline first. */
+#define configUSE_TIMED_EDF                 1
+#define configTIMED_EDF_PRIORITY            6
+/* Overruns and overflows can be handled by a supervisor task, woken directly by
+the tick and the context switch instead of the timer service task. */
+#define configUSE_TIMED_SUPERVISOR          1
+#define configTIMED_EVENT_QUEUE_LENGTH      8
+/* Timed tasks can be given a criticality level. An overrun of a HI task switches
+the kernel to HI mode, where LO tasks run at the idle priority. */
+#define configUSE_TIMED_CRITICALITY         1
+#define configTIMED_HI_MODE_LO_PRIORITY     0
+/* Jobs of timed tasks that use more than 80% of their overrun time are counted
+and reported to the supervisor before the overrun. */
+#define configUSE_TIMED_BUDGET_WARNING      1
+#define configTIMED_BUDGET_WARNING_PERCENT  80
+
+/* Replicated task definitions. */
+#define configMAX_REPLICATED_TASKS          5
+/* Compare digests are computed by the CRC unit. Remove to use the software
+implementation. */
+#define configCOMPARE_DIGEST_UPDATE         compare_digest_crc_update
+
 /* 
  * The CMSIS-RTOS V2 FreeRTOS wrapper is dependent on the heap implementation used
  * by the application thus the correct define need to be enabled below
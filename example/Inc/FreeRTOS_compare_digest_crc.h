@@ -0,0 +1,17 @@
+/**
+ * @file FreeRTOS_compare_digest_crc.h
+ *
+ * @brief   Compare digest of replicated tasks computed by the CRC peripheral
+ */
+#ifndef FREERTOS_COMPARE_DIGEST_CRC_H
+#define FREERTOS_COMPARE_DIGEST_CRC_H
+#include "stdint.h"
+#include "stddef.h"
+
+
+uint32_t compare_digest_crc_update (uint32_t digest,
+                                    const void * p_data,
+                                    size_t length);
+
+#endif /* FREERTOS_COMPARE_DIGEST_CRC_H */
+/****END OF FILE****/
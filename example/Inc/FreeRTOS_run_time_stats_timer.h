@@ -11,6 +11,8 @@
 
 void init_run_time_timer(void);
 uint32_t get_run_time_count (void);
+void arm_run_time_alarm (uint32_t counts);
+void disarm_run_time_alarm (void);
 
 #endif /* FREERTOS_RUN_TIME_STATS_TIMER_H */
 /****END OF FILE****/
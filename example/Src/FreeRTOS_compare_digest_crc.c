@@ -0,0 +1,121 @@
+/**
+ * @file FreeRTOS_compare_digest_crc.c
+ *
+ * @brief   Compare digest of replicated tasks computed by the CRC peripheral.
+ *          Used by FreeRTOS through configCOMPARE_DIGEST_UPDATE.
+ *
+ * @note    CRC unit of STM32F4 computes CRC-32/MPEG-2 over 32 bit words,
+ *          most significant bit first. Digest is defined over bytes in memory
+ *          order, so every word is byte swapped before it is written. Bytes
+ *          that don't form an aligned word are processed in software.
+ *
+ *          The unit can't byte swap its input, neither can the DMA, so the
+ *          unit is fed by the CPU to keep the results identical to the
+ *          software implementation.
+ *
+ * @note    Written according to BARR-C:2018 coding standard
+ *          Exceptions:
+ *              - 3.2 a, c  - Eclipse formatter doesn't support
+ *              - 6.3 b iv. - ERR_CHECK() macro has return keyword
+ *              - 7.1 m     - Boolean begins with is, e.g. is_example
+ */
+
+#include "../../example/Inc/FreeRTOS_compare_digest_crc.h"
+
+#include <FreeRTOS.h>
+#include <task.h>
+#include <compare_digest.h>
+
+#include "crc.h"
+
+#define ph_digest_crc &hcrc
+
+#define CRC_POLYNOMIAL 0x04C11DB7UL
+#define CRC_RESET_VALUE 0xFFFFFFFFUL
+
+/* Below this size software is faster than locking the CRC unit. */
+#define CRC_MIN_WORDS 8U
+
+/* Scheduler is locked at most this many words at once. */
+#define CRC_WORDS_PER_LOCK 256U
+
+static uint32_t crc_restore_word (uint32_t digest);
+
+uint32_t compare_digest_crc_update (uint32_t digest,
+                                    const void * p_data,
+                                    size_t length)
+{
+    const uint8_t * p_bytes = (const uint8_t *) p_data;
+    size_t lead = (sizeof(uint32_t) - ((uintptr_t) p_bytes & 3U)) & 3U;
+
+    if (lead > length)
+    {
+        lead = length;
+    }
+
+    digest = ulCompareDigestUpdateSoftware(digest, p_bytes, lead);
+    p_bytes += lead;
+    length -= lead;
+
+    size_t words = length / sizeof(uint32_t);
+    const uint32_t * p_words = (const uint32_t *) p_bytes;
+
+    if ((words < CRC_MIN_WORDS) ||
+        (taskSCHEDULER_RUNNING != xTaskGetSchedulerState()))
+    {
+        return ulCompareDigestUpdateSoftware(digest, p_bytes, length);
+    }
+
+    while (words > 0)
+    {
+        size_t chunk = (words < CRC_WORDS_PER_LOCK) ? words : CRC_WORDS_PER_LOCK;
+
+        /* CRC unit is shared, other replicas may use it as well */
+        vTaskSuspendAll();
+
+        __HAL_CRC_DR_RESET(ph_digest_crc);
+        (ph_digest_crc)->Instance->DR = crc_restore_word(digest);
+
+        for (size_t word = 0; word < chunk; word++)
+        {
+            (ph_digest_crc)->Instance->DR = __REV(p_words[word]);
+        }
+
+        digest = (ph_digest_crc)->Instance->DR;
+
+        (void) xTaskResumeAll();
+
+        p_words += chunk;
+        words -= chunk;
+    }
+
+    return ulCompareDigestUpdateSoftware(digest,
+                                         p_words,
+                                         length & (sizeof(uint32_t) - 1U));
+}
+
+/**
+ * @brief   Returns the word that moves the CRC unit from its reset value to
+ *          the given digest.
+ *
+ * @note    Writing word w changes the state from s to shift(s ^ w), where
+ *          shift is 32 steps of the CRC. Shift is inverted step by step.
+ */
+static uint32_t crc_restore_word (uint32_t digest)
+{
+    for (uint32_t bit = 0; bit < 32U; bit++)
+    {
+        if (0U != (digest & 1U))
+        {
+            digest = ((digest ^ CRC_POLYNOMIAL) >> 1) | 0x80000000UL;
+        }
+        else
+        {
+            digest >>= 1;
+        }
+    }
+
+    return digest ^ CRC_RESET_VALUE;
+}
+
+/****END OF FILE****/
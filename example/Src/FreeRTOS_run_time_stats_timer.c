@@ -15,14 +15,25 @@
 
 #include "tim.h"
 
+#include <FreeRTOS.h>
+#include <task.h>
+
 #define ph_stats_timer &htim2
 
 #define INIT_RUN_TIME_STATS_TIMER(name) MX_##name##_Init()
 
+/* Compare value must be ahead of the counter when it is written. */
+#define RUN_TIME_ALARM_MIN_COUNTS 2
+
 void init_run_time_timer (void)
 {
     INIT_RUN_TIME_STATS_TIMER(TIM2);
 
+    HAL_NVIC_SetPriority(TIM2_IRQn,
+                         configLIBRARY_MAX_SYSCALL_INTERRUPT_PRIORITY,
+                         0);
+    HAL_NVIC_EnableIRQ(TIM2_IRQn);
+
     HAL_TIM_Base_Start(ph_stats_timer);
 }
 
@@ -31,4 +42,42 @@ uint32_t get_run_time_count (void)
     return __HAL_TIM_GET_COUNTER(ph_stats_timer);
 }
 
+void arm_run_time_alarm (uint32_t counts)
+{
+    if (counts < RUN_TIME_ALARM_MIN_COUNTS)
+    {
+        counts = RUN_TIME_ALARM_MIN_COUNTS;
+    }
+
+    __HAL_TIM_SET_COMPARE(ph_stats_timer,
+                          TIM_CHANNEL_1,
+                          __HAL_TIM_GET_COUNTER(ph_stats_timer) + counts);
+    __HAL_TIM_CLEAR_IT(ph_stats_timer, TIM_IT_CC1);
+    __HAL_TIM_ENABLE_IT(ph_stats_timer, TIM_IT_CC1);
+}
+
+void disarm_run_time_alarm (void)
+{
+    __HAL_TIM_DISABLE_IT(ph_stats_timer, TIM_IT_CC1);
+}
+
+void TIM2_IRQHandler (void)
+{
+    BaseType_t is_woken = pdFALSE;
+
+    if ((__HAL_TIM_GET_FLAG(ph_stats_timer, TIM_FLAG_CC1) != RESET) &&
+        (__HAL_TIM_GET_IT_SOURCE(ph_stats_timer, TIM_IT_CC1) != RESET))
+    {
+        /* One-shot, kernel arms it again if needed. */
+        disarm_run_time_alarm();
+        __HAL_TIM_CLEAR_IT(ph_stats_timer, TIM_IT_CC1);
+
+#if ( configTIMED_BUDGET_IN_RUN_TIME_COUNTS == 1 )
+        vTaskTimedBudgetExpiredFromISR(&is_woken);
+#endif
+    }
+
+    portYIELD_FROM_ISR(is_woken);
+}
+
 /****END OF FILE****/
@@ -36,7 +36,7 @@
 #define PRIORITY_TIMED_RESET_FAIL_DEL 3
 
 #define TIMEOUT_OFLOW pdMS_TO_TICKS(6 * 1000)
-#define TIMEOUT_ORUN  (5 * 1000)
+#define TIMEOUT_ORUN  taskUS_TO_OVERRUN_TIME(5 * 1000 * 1000)
 
 /******************************************************************************/
 
@@ -0,0 +1,14 @@
+/**
+ * @file tests_benchmark.h
+ *
+ * @brief   Benchmarks for added FreeRTOS functionality.
+ */
+#ifndef TESTS_BENCHMARK_H
+#define TESTS_BENCHMARK_H
+
+#include "tests.h"
+
+void tests_benchmark(void);
+
+#endif /* TESTS_BENCHMARK_H */
+/****END OF FILE****/
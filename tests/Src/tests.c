@@ -19,6 +19,7 @@
 #include "tests_timer_additions.h"
 #include "tests_replicated_task.h"
 #include "tests_get_type.h"
+#include "tests_benchmark.h"
 
 /*----------------------------------------------------------------------------*/
 
@@ -53,6 +54,11 @@ void tests_task(void * unused)
         test_status_t test_status = tests_get_type();
         ndebug_printf("%s\n", TEST_PASS == test_status ? "OK" : "ERROR");
 #endif
+
+#if 1
+        ndebug_printf("Benchmarks:\n");
+        tests_benchmark();
+#endif
         vTaskDelay(pdMS_TO_TICKS(2 * 1000));
     }
 }
@@ -0,0 +1,332 @@
+/**
+ * @file tests_benchmark.c
+ *
+ * @brief   Benchmarks for added FreeRTOS functionality.
+ *
+ * @note    Time is measured with the run time statistics counter, which has a
+ *          resolution of 1 us. Results are averaged over many rounds.
+ */
+
+#include "tests_benchmark.h"
+
+#include <FreeRTOS.h>
+#include <task.h>
+#include <queue.h>
+#include <timers.h>
+#include <compare_digest.h>
+
+#include <stdbool.h>
+
+#include <ndebug_printf.h>
+
+/******************************************************************************/
+
+#undef PRIORITY_TEST
+#define PRIORITY_TEST 4
+
+#define RUN_TIME_COUNT_US 1 /* Period of run time counter in us. */
+
+#define SYNC_ROUNDS 10000
+
+#define DIGEST_ROUNDS 1000
+#define DIGEST_SIZE 2048
+
+#define COMMAND_ROUNDS 1000
+#define COMMAND_BATCH configTIMER_QUEUE_LENGTH
+
+#if ( configUSE_TIMER_COMMAND_RING == 1 )
+#   define COMMAND_CHANNEL "ring"
+#else
+#   define COMMAND_CHANNEL "queue"
+#endif
+
+/******************************************************************************/
+
+test_status_t benchmark_sync_latency(uint8_t replicas);
+test_status_t benchmark_digest(void);
+test_status_t benchmark_timer_commands(void);
+
+/******************************************************************************/
+
+void tests_benchmark(void)
+{
+#if ( configGENERATE_RUN_TIME_STATS == 1 )
+    ndebug_printf("   Sync latency, 2 replicas...%s\n",
+                  benchmark_sync_latency(taskREPLICATED_NO_RECOVERY) == TEST_PASS?
+                  "OK": "FAIL");
+
+    ndebug_printf("   Sync latency, 3 replicas...%s\n",
+                  benchmark_sync_latency(taskREPLICATED_RECOVERY) == TEST_PASS?
+                  "OK": "FAIL");
+
+    ndebug_printf("   Compare digest of 2 kB, software and selected backend...%s\n",
+                  benchmark_digest() == TEST_PASS?
+                  "OK": "FAIL");
+
+    ndebug_printf("   Timer commands, " COMMAND_CHANNEL " and reference queue...%s\n",
+                  benchmark_timer_commands() == TEST_PASS?
+                  "OK": "FAIL");
+#else
+    ndebug_printf("   Run time statistics are disabled, skipping\n");
+#endif
+}
+
+/******************************************************************************/
+
+#if ( configGENERATE_RUN_TIME_STATS == 1 )
+
+uint8_t sync_latency_cb(CompareValue_t * pxCompareValues, uint8_t ucLen);
+static void task_sync_latency(void * unused);
+
+static volatile uint32_t sync_start = 0;
+static volatile uint32_t sync_end = 0;
+static volatile uint8_t sync_finished = 0;
+static bool sync_is_success = true;
+
+test_status_t benchmark_sync_latency(uint8_t replicas)
+{
+    TaskHandle_t h_replicated = NULL;
+
+    sync_is_success = true;
+    sync_finished = 0;
+
+    xTaskCreateReplicated(task_sync_latency,
+                          "Sync bench",
+                          configMINIMAL_STACK_SIZE,
+                          NULL,
+                          PRIORITY_TEST,
+                          &h_replicated,
+                          replicas,
+                          sync_latency_cb);
+
+    if(h_replicated == NULL)
+    {
+        return TEST_FAIL;
+    }
+
+    /* Replicas have higher priority, so they are finished long before */
+    vTaskDelay(pdMS_TO_TICKS(5000));
+
+    vTaskDelete(h_replicated);
+
+    if(sync_finished != replicas || !sync_is_success)
+    {
+        return TEST_FAIL;
+    }
+
+    uint32_t elapsed_us = (sync_end - sync_start) * RUN_TIME_COUNT_US;
+
+    ndebug_printf("      %lu rounds in %lu us, %lu ns per round\n",
+                  (uint32_t)SYNC_ROUNDS,
+                  elapsed_us,
+                  (uint32_t)(((uint64_t)elapsed_us * 1000U) / SYNC_ROUNDS));
+
+    return TEST_PASS;
+}
+
+static void task_sync_latency(void * unused)
+{
+    const CompareValue_t value = 10;
+
+    /* First synchronization only aligns the replicas */
+    vTaskSyncAndCompare(&value);
+    sync_start = portGET_RUN_TIME_COUNTER_VALUE();
+
+    for(uint32_t round = 0; round < SYNC_ROUNDS; round++)
+    {
+        vTaskSyncAndCompare(&value);
+    }
+
+    taskENTER_CRITICAL();
+    sync_end = portGET_RUN_TIME_COUNTER_VALUE();
+    sync_finished++;
+    taskEXIT_CRITICAL();
+
+    vTaskDelay(portMAX_DELAY);
+}
+
+uint8_t sync_latency_cb(CompareValue_t * pxCompareValues, uint8_t ucLen)
+{
+    sync_is_success = false;
+
+    return pdFALSE;
+}
+
+/******************************************************************************/
+
+test_status_t benchmark_digest(void)
+{
+    static uint32_t data[DIGEST_SIZE / sizeof(uint32_t)];
+    uint32_t digest_sw = digestINITIAL_VALUE;
+    uint32_t digest_backend = digestINITIAL_VALUE;
+
+    for(uint32_t iii = 0; iii < sizeof(data) / sizeof(data[0]); iii++)
+    {
+        data[iii] = iii * 0x9E3779B9UL;
+    }
+
+    uint32_t start = portGET_RUN_TIME_COUNTER_VALUE();
+
+    for(uint32_t round = 0; round < DIGEST_ROUNDS; round++)
+    {
+        digest_sw = ulCompareDigestUpdateSoftware(digest_sw, data, DIGEST_SIZE);
+    }
+
+    uint32_t elapsed_sw_us = (portGET_RUN_TIME_COUNTER_VALUE() - start) * RUN_TIME_COUNT_US;
+
+    start = portGET_RUN_TIME_COUNTER_VALUE();
+
+    for(uint32_t round = 0; round < DIGEST_ROUNDS; round++)
+    {
+        digest_backend = ulCompareDigestUpdate(digest_backend, data, DIGEST_SIZE);
+    }
+
+    uint32_t elapsed_backend_us = (portGET_RUN_TIME_COUNTER_VALUE() - start) * RUN_TIME_COUNT_US;
+
+    ndebug_printf("      software %lu ns, backend %lu ns per digest\n",
+                  (uint32_t)(((uint64_t)elapsed_sw_us * 1000U) / DIGEST_ROUNDS),
+                  (uint32_t)(((uint64_t)elapsed_backend_us * 1000U) / DIGEST_ROUNDS));
+
+    return (digest_sw == digest_backend) ? TEST_PASS : TEST_FAIL;
+}
+
+/******************************************************************************/
+
+/* Same size as a message of the timer service task */
+typedef struct
+{
+    BaseType_t id;
+    TickType_t value;
+    void * p_timer;
+    uint32_t unused;
+} command_t;
+
+static void command_timer_cb(TimerHandle_t h_timer);
+static void task_command_receiver(void * p_queue);
+static void print_command_rate(const char * p_name, uint32_t elapsed, uint32_t enqueue);
+
+test_status_t benchmark_timer_commands(void)
+{
+    TimerHandle_t h_timer = NULL;
+    QueueHandle_t h_queue = NULL;
+    TaskHandle_t h_receiver = NULL;
+    command_t command = {0};
+    uint32_t enqueue = 0;
+    bool is_success = true;
+
+    /* Timer is reset again long before it expires */
+    h_timer = xTimerCreate("Cmd bench", pdMS_TO_TICKS(10 * 1000), pdFALSE,
+                           NULL, command_timer_cb);
+    h_queue = xQueueCreate(COMMAND_BATCH, sizeof(command_t));
+
+    if(h_timer == NULL || h_queue == NULL)
+    {
+        is_success = false;
+        goto cleanup;
+    }
+
+    /* Commands of a batch are enqueued with the scheduler suspended, so only
+     * the enqueue is measured. Receiver runs when the scheduler is resumed. */
+    uint32_t start = portGET_RUN_TIME_COUNTER_VALUE();
+
+    for(uint32_t round = 0; round < COMMAND_ROUNDS; round++)
+    {
+        vTaskSuspendAll();
+        uint32_t enqueue_start = portGET_RUN_TIME_COUNTER_VALUE();
+
+        for(uint8_t iii = 0; iii < COMMAND_BATCH; iii++)
+        {
+            is_success &= (xTimerReset(h_timer, 0) == pdPASS);
+        }
+
+        enqueue += portGET_RUN_TIME_COUNTER_VALUE() - enqueue_start;
+        xTaskResumeAll();
+    }
+
+    print_command_rate("timer " COMMAND_CHANNEL,
+                       portGET_RUN_TIME_COUNTER_VALUE() - start, enqueue);
+
+    /* Reference is a plain queue with a receiver of higher priority */
+    xTaskCreate(task_command_receiver,
+                "Cmd receiver",
+                configMINIMAL_STACK_SIZE,
+                h_queue,
+                PRIORITY_TEST + 1,
+                &h_receiver);
+
+    if(h_receiver == NULL)
+    {
+        is_success = false;
+        goto cleanup;
+    }
+
+    enqueue = 0;
+    start = portGET_RUN_TIME_COUNTER_VALUE();
+
+    for(uint32_t round = 0; round < COMMAND_ROUNDS; round++)
+    {
+        vTaskSuspendAll();
+        uint32_t enqueue_start = portGET_RUN_TIME_COUNTER_VALUE();
+
+        for(uint8_t iii = 0; iii < COMMAND_BATCH; iii++)
+        {
+            command.value = iii;
+            is_success &= (xQueueSendToBack(h_queue, &command, 0) == pdPASS);
+        }
+
+        enqueue += portGET_RUN_TIME_COUNTER_VALUE() - enqueue_start;
+        xTaskResumeAll();
+    }
+
+    print_command_rate("reference queue",
+                       portGET_RUN_TIME_COUNTER_VALUE() - start, enqueue);
+
+cleanup:
+    if(h_receiver != NULL)
+    {
+        vTaskDelete(h_receiver);
+    }
+
+    if(h_queue != NULL)
+    {
+        vQueueDelete(h_queue);
+    }
+
+    if(h_timer != NULL)
+    {
+        xTimerDelete(h_timer, portMAX_DELAY);
+    }
+
+    return is_success ? TEST_PASS : TEST_FAIL;
+}
+
+static void print_command_rate(const char * p_name, uint32_t elapsed, uint32_t enqueue)
+{
+    const uint32_t commands = (uint32_t)COMMAND_ROUNDS * COMMAND_BATCH;
+    uint32_t elapsed_us = elapsed * RUN_TIME_COUNT_US;
+    uint32_t enqueue_us = enqueue * RUN_TIME_COUNT_US;
+
+    ndebug_printf("      %s: %lu commands per second, %lu ns per enqueue\n",
+                  p_name,
+                  (uint32_t)(((uint64_t)commands * 1000000U) / (elapsed_us ? elapsed_us : 1U)),
+                  (uint32_t)(((uint64_t)enqueue_us * 1000U) / commands));
+}
+
+static void command_timer_cb(TimerHandle_t h_timer)
+{
+}
+
+static void task_command_receiver(void * p_queue)
+{
+    command_t command;
+
+    while(true)
+    {
+        xQueueReceive((QueueHandle_t)p_queue, &command, portMAX_DELAY);
+    }
+}
+
+#endif /* configGENERATE_RUN_TIME_STATS == 1 */
+
+/******************************************************************************/
+/****END OF FILE****/
@@ -8,8 +8,10 @@
 
 #include <FreeRTOS.h>
 #include <task.h>
+#include <compare_digest.h>
 
 #include <stdbool.h>
+#include <string.h>
 
 #include <ndebug_printf.h>
 
@@ -31,6 +33,18 @@ test_status_t test_shall_call_recovery_callback(void);
 test_status_t test_shall_not_call_recovery_callback_setCompare(void);
 test_status_t test_shall_call_recovery_callback_setCompare(void);
 test_status_t test_deleting_replicated(void);
+test_status_t test_five_replicas_majority(void);
+test_status_t test_deleting_five_replicas(void);
+test_status_t test_vote_compare_values(void);
+test_status_t test_compare_digest(void);
+test_status_t test_compare_digest_backends(void);
+test_status_t test_digest_reports_diverged_replica(void);
+test_status_t test_respawn_diverged_replica(void);
+test_status_t test_early_release(void);
+test_status_t test_early_release_late_mismatch(void);
+test_status_t test_pipelined_reports_sync_index(void);
+test_status_t test_checkpoints_report_first_diverged(void);
+test_status_t test_static_replicated(void);
 
 /******************************************************************************/
 
@@ -63,6 +77,54 @@ void tests_replicated_task(void)
     ndebug_printf("   Deleting non recoverable and recoverable test...%s\n",
                   test_deleting_replicated() == TEST_PASS?
                   "OK": "FAIL");
+
+    ndebug_printf("   Five replicas, one diverged, majority voted...%s\n",
+                  test_five_replicas_majority() == TEST_PASS?
+                  "OK": "FAIL");
+
+    ndebug_printf("   Deleting five replicas...%s\n",
+                  test_deleting_five_replicas() == TEST_PASS?
+                  "OK": "FAIL");
+
+    ndebug_printf("   Voting on compare values...%s\n",
+                  test_vote_compare_values() == TEST_PASS?
+                  "OK": "FAIL");
+
+    ndebug_printf("   Compare digest of byte ranges and scatter lists...%s\n",
+                  test_compare_digest() == TEST_PASS?
+                  "OK": "FAIL");
+
+    ndebug_printf("   Compare digest backend matches software...%s\n",
+                  test_compare_digest_backends() == TEST_PASS?
+                  "OK": "FAIL");
+
+    ndebug_printf("   Digest mismatch reports diverged replica...%s\n",
+                  test_digest_reports_diverged_replica() == TEST_PASS?
+                  "OK": "FAIL");
+
+    ndebug_printf("   Respawn diverged replica and copy state...%s\n",
+                  test_respawn_diverged_replica() == TEST_PASS?
+                  "OK": "FAIL");
+
+    ndebug_printf("   Early release doesn't wait for slow replica...%s\n",
+                  test_early_release() == TEST_PASS?
+                  "OK": "FAIL");
+
+    ndebug_printf("   Early release, late mismatch calls callback...%s\n",
+                  test_early_release_late_mismatch() == TEST_PASS?
+                  "OK": "FAIL");
+
+    ndebug_printf("   Pipelined replicas run ahead, mismatch reports sync index...%s\n",
+                  test_pipelined_reports_sync_index() == TEST_PASS?
+                  "OK": "FAIL");
+
+    ndebug_printf("   Checkpoints compared on one sync, first diverged reported...%s\n",
+                  test_checkpoints_report_first_diverged() == TEST_PASS?
+                  "OK": "FAIL");
+
+    ndebug_printf("   Static replicated task, shall call callback...%s\n",
+                  test_static_replicated() == TEST_PASS?
+                  "OK": "FAIL");
 }
 
 /******************************************************************************/
@@ -424,5 +486,891 @@ uint8_t deleting_task_cb(CompareValue_t * pxCompareValues, uint8_t ucLen)
     return pdFALSE;
 }
 
+/******************************************************************************/
+
+#define FIVE_REPLICAS 5
+
+uint8_t five_replicas_cb(CompareValue_t * pxCompareValues, uint8_t ucLen);
+static void task_five_replicas(void * unused);
+
+static uint8_t five_replicas_started = 0;
+
+test_status_t test_five_replicas_majority(void)
+{
+    TaskHandle_t h_replicated = NULL;
+
+    g_is_success = false;
+    five_replicas_started = 0;
+
+    xTaskCreateReplicated(task_five_replicas,
+                          "Five",
+                          configMINIMAL_STACK_SIZE,
+                          NULL,
+                          PRIORITY_TEST,
+                          &h_replicated,
+                          FIVE_REPLICAS,
+                          five_replicas_cb);
+
+    vTaskDelay(pdMS_TO_TICKS(2000));
+
+    if(h_replicated != NULL)
+    {
+        vTaskDelete(h_replicated);
+    }
+
+    return g_is_success ? TEST_PASS: TEST_FAIL;
+}
+
+static void task_five_replicas(void * unused)
+{
+    CompareValue_t value = 10;
+
+    /* First started replica diverges from the others */
+    taskENTER_CRITICAL();
+    if(five_replicas_started++ == 0)
+    {
+        value = 11;
+    }
+    taskEXIT_CRITICAL();
+
+    while(true)
+    {
+        vTaskSyncAndCompare(&value);
+        vTaskDelay(pdMS_TO_TICKS(10));
+    }
+}
+
+uint8_t five_replicas_cb(CompareValue_t * pxCompareValues, uint8_t ucLen)
+{
+    CompareValue_t voted = 0;
+
+    if(ucLen == FIVE_REPLICAS &&
+       ucTaskVoteCompareValues(pxCompareValues, ucLen, &voted) == (FIVE_REPLICAS - 1) &&
+       voted == 10)
+    {
+        g_is_success = true;
+    }
+    else
+    {
+        g_is_success = false;
+    }
+
+    return pdFALSE;
+}
+
+/******************************************************************************/
+
+test_status_t test_deleting_five_replicas(void)
+{
+    TaskHandle_t h_replicated = NULL;
+
+    xTaskCreateReplicated(task_deleting_task,
+                          "Five",
+                          configMINIMAL_STACK_SIZE,
+                          NULL,
+                          PRIORITY_TEST,
+                          &h_replicated,
+                          FIVE_REPLICAS,
+                          deleting_task_cb);
+
+    uint32_t num_of_tasks = uxTaskGetNumberOfTasks();
+
+    if(h_replicated != NULL)
+    {
+        vTaskDelete(h_replicated);
+    }
+
+    if(uxTaskGetNumberOfTasks() != (num_of_tasks - FIVE_REPLICAS))
+    {
+        return TEST_FAIL;
+    }
+
+    return TEST_PASS;
+}
+
+/******************************************************************************/
+
+test_status_t test_vote_compare_values(void)
+{
+    const CompareValue_t unanimous[] = {7, 7, 7};
+    const CompareValue_t majority[] = {1, 2, 2, 3, 2};
+    const CompareValue_t plurality[] = {4, 5, 6, 5, 4, 5};
+    const CompareValue_t tie[] = {8, 9};
+    CompareValue_t voted = 0;
+
+    if(ucTaskVoteCompareValues(unanimous, 3, &voted) != 3 || voted != 7)
+    {
+        return TEST_FAIL;
+    }
+
+    if(ucTaskVoteCompareValues(majority, 5, &voted) != 3 || voted != 2)
+    {
+        return TEST_FAIL;
+    }
+
+    if(ucTaskVoteCompareValues(plurality, 6, &voted) != 3 || voted != 5)
+    {
+        return TEST_FAIL;
+    }
+
+    /* On tie the first value wins, but there is no majority */
+    if(ucTaskVoteCompareValues(tie, 2, &voted) != 1 || voted != 8)
+    {
+        return TEST_FAIL;
+    }
+
+    if(ucTaskVoteCompareValues(majority, 5, NULL) != 3)
+    {
+        return TEST_FAIL;
+    }
+
+    return TEST_PASS;
+}
+
+/******************************************************************************/
+
+#define DIGEST_STATE_SIZE 2048
+
+test_status_t test_compare_digest(void)
+{
+    static uint8_t data[DIGEST_STATE_SIZE + 3];
+    const char check[] = "123456789";
+
+    /* Check value of CRC-32/MPEG-2 */
+    if(ulCompareDigestUpdate(digestINITIAL_VALUE, check, 9) != 0x0376E6E7UL)
+    {
+        return TEST_FAIL;
+    }
+
+    for(uint32_t iii = 0; iii < sizeof(data); iii++)
+    {
+        data[iii] = (uint8_t)(iii * 7 + 3);
+    }
+
+    /* Result shall not depend on alignment or on splitting of the data */
+    for(uint32_t offset = 0; offset < 4; offset++)
+    {
+        uint32_t whole = ulCompareDigestUpdate(digestINITIAL_VALUE,
+                                               &data[offset],
+                                               DIGEST_STATE_SIZE);
+        uint32_t split = ulCompareDigestUpdate(digestINITIAL_VALUE,
+                                               &data[offset],
+                                               5);
+        split = ulCompareDigestUpdate(split,
+                                      &data[offset + 5],
+                                      DIGEST_STATE_SIZE - 5);
+
+        if(whole != split)
+        {
+            return TEST_FAIL;
+        }
+    }
+
+    return TEST_PASS;
+}
+
+/******************************************************************************/
+
+test_status_t test_compare_digest_backends(void)
+{
+    static uint8_t data[DIGEST_STATE_SIZE + 3];
+    const uint32_t lengths[] = {0, 1, 3, 4, 7, 31, 32, 33, 255, 1024, DIGEST_STATE_SIZE};
+    const uint32_t initial[] = {digestINITIAL_VALUE, 0x00000000UL, 0x12345678UL};
+
+    for(uint32_t iii = 0; iii < sizeof(data); iii++)
+    {
+        data[iii] = (uint8_t)(iii * 13 + 1);
+    }
+
+    /* Selected backend shall match software for any alignment, length and
+     * digest to continue from */
+    for(uint32_t offset = 0; offset < 4; offset++)
+    {
+        for(uint32_t len = 0; len < sizeof(lengths) / sizeof(lengths[0]); len++)
+        {
+            for(uint32_t init = 0; init < sizeof(initial) / sizeof(initial[0]); init++)
+            {
+                if(ulCompareDigestUpdate(initial[init], &data[offset], lengths[len]) !=
+                   ulCompareDigestUpdateSoftware(initial[init], &data[offset], lengths[len]))
+                {
+                    return TEST_FAIL;
+                }
+            }
+        }
+    }
+
+    return TEST_PASS;
+}
+
+/******************************************************************************/
+
+uint8_t digest_diverged_cb(CompareValue_t * pxCompareValues, uint8_t ucLen);
+static void task_digest_diverged(void * unused);
+
+static uint8_t digest_replicas_started = 0;
+static volatile UBaseType_t digest_diverged_index = 0;
+static uint8_t digest_state[taskREPLICATED_RECOVERY][DIGEST_STATE_SIZE];
+
+test_status_t test_digest_reports_diverged_replica(void)
+{
+    TaskHandle_t h_replicated = NULL;
+
+    g_is_success = false;
+    digest_replicas_started = 0;
+
+    xTaskCreateReplicated(task_digest_diverged,
+                          "Digest",
+                          configMINIMAL_STACK_SIZE,
+                          NULL,
+                          PRIORITY_TEST,
+                          &h_replicated,
+                          taskREPLICATED_RECOVERY,
+                          digest_diverged_cb);
+
+    vTaskDelay(pdMS_TO_TICKS(2000));
+
+    if(h_replicated != NULL)
+    {
+        vTaskDelete(h_replicated);
+    }
+
+    return g_is_success ? TEST_PASS: TEST_FAIL;
+}
+
+static void task_digest_diverged(void * unused)
+{
+    uint8_t * state;
+    UBaseType_t index = uxTaskGetReplicaIndex(NULL);
+    bool is_diverged = false;
+
+    state = digest_state[index];
+    memset(state, 0x5A, DIGEST_STATE_SIZE);
+
+    /* First started replica diverges in the last byte of its state */
+    taskENTER_CRITICAL();
+    if(digest_replicas_started++ == 0)
+    {
+        is_diverged = true;
+        digest_diverged_index = index;
+    }
+    taskEXIT_CRITICAL();
+
+    if(is_diverged)
+    {
+        state[DIGEST_STATE_SIZE - 1] ^= 0x01;
+    }
+
+    const CompareDigestSegment_t segments[] =
+    {
+        {&state[0], 1},
+        {&state[1], DIGEST_STATE_SIZE / 2},
+        {&state[1 + DIGEST_STATE_SIZE / 2], DIGEST_STATE_SIZE / 2 - 1},
+    };
+
+    while(true)
+    {
+        /* Byte range and scatter list shall produce the same digest */
+        vTaskCompareDigestReset();
+        if(index % 2 == 0)
+        {
+            vTaskCompareDigestUpdate(state, DIGEST_STATE_SIZE);
+        }
+        else
+        {
+            vTaskCompareDigestUpdateScatter(segments, 3);
+        }
+
+        vTaskSyncAndCompare(NULL);
+        vTaskDelay(pdMS_TO_TICKS(10));
+    }
+}
+
+uint8_t digest_diverged_cb(CompareValue_t * pxCompareValues, uint8_t ucLen)
+{
+    ReplicatedMismatch_t mismatch;
+
+    if(xTaskGetReplicatedMismatch(NULL, &mismatch) == pdTRUE &&
+       mismatch.ulDivergedMask == (1UL << digest_diverged_index) &&
+       mismatch.ucVotes == (taskREPLICATED_RECOVERY - 1))
+    {
+        g_is_success = true;
+    }
+    else
+    {
+        g_is_success = false;
+    }
+
+    return pdFALSE;
+}
+
+/******************************************************************************/
+
+#define RESPAWN_CORRUPT_ROUND 5
+
+typedef struct
+{
+    uint32_t round;
+    CompareValue_t sum;
+} respawn_state_t;
+
+uint8_t respawn_cb(CompareValue_t * pxCompareValues, uint8_t ucLen);
+static void task_respawn(void * unused);
+
+static uint8_t respawn_started = 0;
+static uint8_t respawn_mismatches = 0;
+static bool respawn_is_corrupted = false;
+static volatile uint32_t respawn_rounds_after = 0;
+
+test_status_t test_respawn_diverged_replica(void)
+{
+    TaskHandle_t h_replicated = NULL;
+
+    respawn_started = 0;
+    respawn_mismatches = 0;
+    respawn_is_corrupted = false;
+    respawn_rounds_after = 0;
+
+    xTaskCreateReplicated(task_respawn,
+                          "Respawn",
+                          configMINIMAL_STACK_SIZE,
+                          NULL,
+                          PRIORITY_TEST,
+                          &h_replicated,
+                          taskREPLICATED_RECOVERY,
+                          respawn_cb);
+
+    uint32_t num_of_tasks = uxTaskGetNumberOfTasks();
+
+    vTaskDelay(pdMS_TO_TICKS(2000));
+
+    /* Deleted replica is freed by idle task, count only running tasks */
+    bool is_full_group = (uxTaskGetNumberOfTasks() == num_of_tasks);
+
+    if(h_replicated != NULL)
+    {
+        vTaskDelete(h_replicated);
+    }
+
+    /* One mismatch, one new task and replicas keep agreeing afterwards */
+    if(respawn_mismatches != 1 ||
+       respawn_started != (taskREPLICATED_RECOVERY + 1) ||
+       respawn_rounds_after < 10 ||
+       !is_full_group)
+    {
+        return TEST_FAIL;
+    }
+
+    return TEST_PASS;
+}
+
+static void task_respawn(void * unused)
+{
+    respawn_state_t * state = pvTaskGetReplicatedState(sizeof(respawn_state_t));
+
+    taskENTER_CRITICAL();
+    respawn_started++;
+    taskEXIT_CRITICAL();
+
+    while(true)
+    {
+        state->round++;
+        state->sum += state->round;
+
+        /* One replica corrupts its state once */
+        taskENTER_CRITICAL();
+        if(state->round == RESPAWN_CORRUPT_ROUND && !respawn_is_corrupted)
+        {
+            respawn_is_corrupted = true;
+            state->sum += 1000;
+        }
+        taskEXIT_CRITICAL();
+
+        vTaskSyncAndCompare(&state->sum);
+
+        if(respawn_mismatches == 1 && uxTaskGetReplicaIndex(NULL) == 0)
+        {
+            respawn_rounds_after++;
+        }
+
+        vTaskDelay(pdMS_TO_TICKS(10));
+    }
+}
+
+uint8_t respawn_cb(CompareValue_t * pxCompareValues, uint8_t ucLen)
+{
+    respawn_mismatches++;
+
+    return taskREPLICATED_RESPAWN;
+}
+
+/******************************************************************************/
+
+#define EARLY_SLOW_DELAY_MS 100
+
+uint8_t early_release_cb(CompareValue_t * pxCompareValues, uint8_t ucLen);
+static void task_early_release(void * unused);
+
+static uint8_t early_started = 0;
+static volatile TickType_t early_slow_arrival = 0;
+static volatile TickType_t early_fast_release = 0;
+static volatile uint8_t early_released = 0;
+
+test_status_t test_early_release(void)
+{
+    TaskHandle_t h_replicated = NULL;
+
+    g_is_success = true;
+    early_started = 0;
+    early_slow_arrival = 0;
+    early_fast_release = 0;
+    early_released = 0;
+
+    xTaskCreateReplicated(task_early_release,
+                          "Early",
+                          configMINIMAL_STACK_SIZE,
+                          NULL,
+                          PRIORITY_TEST,
+                          &h_replicated,
+                          taskREPLICATED_RECOVERY | taskREPLICATED_EARLY_RELEASE,
+                          early_release_cb);
+
+    vTaskDelay(pdMS_TO_TICKS(2 * EARLY_SLOW_DELAY_MS));
+
+    if(h_replicated != NULL)
+    {
+        vTaskDelete(h_replicated);
+    }
+
+    /* Fast replicas are released before slow one arrives */
+    if(!g_is_success ||
+       early_released != taskREPLICATED_RECOVERY ||
+       early_fast_release == 0 ||
+       early_fast_release >= early_slow_arrival)
+    {
+        return TEST_FAIL;
+    }
+
+    return TEST_PASS;
+}
+
+static void task_early_release(void * unused)
+{
+    const CompareValue_t value = 10;
+    bool is_slow = false;
+
+    taskENTER_CRITICAL();
+    if(early_started++ == 0)
+    {
+        is_slow = true;
+    }
+    taskEXIT_CRITICAL();
+
+    if(is_slow)
+    {
+        vTaskDelay(pdMS_TO_TICKS(EARLY_SLOW_DELAY_MS));
+        early_slow_arrival = xTaskGetTickCount();
+    }
+
+    vTaskSyncAndCompare(&value);
+
+    taskENTER_CRITICAL();
+    if(!is_slow && early_fast_release == 0)
+    {
+        early_fast_release = xTaskGetTickCount();
+    }
+    early_released++;
+    taskEXIT_CRITICAL();
+
+    vTaskDelay(portMAX_DELAY);
+}
+
+uint8_t early_release_cb(CompareValue_t * pxCompareValues, uint8_t ucLen)
+{
+    g_is_success = false;
+
+    return pdFALSE;
+}
+
+/******************************************************************************/
+
+uint8_t early_late_mismatch_cb(CompareValue_t * pxCompareValues, uint8_t ucLen);
+static void task_early_late_mismatch(void * unused);
+
+static uint8_t early_late_started = 0;
+static volatile UBaseType_t early_late_index = 0;
+
+test_status_t test_early_release_late_mismatch(void)
+{
+    TaskHandle_t h_replicated = NULL;
+
+    g_is_success = false;
+    early_late_started = 0;
+
+    xTaskCreateReplicated(task_early_late_mismatch,
+                          "Early late",
+                          configMINIMAL_STACK_SIZE,
+                          NULL,
+                          PRIORITY_TEST,
+                          &h_replicated,
+                          taskREPLICATED_RECOVERY | taskREPLICATED_EARLY_RELEASE,
+                          early_late_mismatch_cb);
+
+    vTaskDelay(pdMS_TO_TICKS(2000));
+
+    if(h_replicated != NULL)
+    {
+        vTaskDelete(h_replicated);
+    }
+
+    return g_is_success ? TEST_PASS: TEST_FAIL;
+}
+
+static void task_early_late_mismatch(void * unused)
+{
+    CompareValue_t value = 10;
+    bool is_late = false;
+
+    /* First started replica is always late and diverges */
+    taskENTER_CRITICAL();
+    if(early_late_started++ == 0)
+    {
+        is_late = true;
+        value = 11;
+        early_late_index = uxTaskGetReplicaIndex(NULL);
+    }
+    taskEXIT_CRITICAL();
+
+    while(true)
+    {
+        if(is_late)
+        {
+            vTaskDelay(pdMS_TO_TICKS(5));
+        }
+
+        vTaskSyncAndCompare(&value);
+        vTaskDelay(pdMS_TO_TICKS(10));
+    }
+}
+
+uint8_t early_late_mismatch_cb(CompareValue_t * pxCompareValues, uint8_t ucLen)
+{
+    ReplicatedMismatch_t mismatch;
+
+    /* Only late comparison is expected, with the late replica diverged */
+    if(xTaskGetReplicatedMismatch(NULL, &mismatch) == pdTRUE &&
+       uxTaskGetReplicaIndex(NULL) == early_late_index &&
+       mismatch.ulDivergedMask == (1UL << early_late_index) &&
+       mismatch.xVotedValue == 10 &&
+       mismatch.ucVotes == (taskREPLICATED_RECOVERY - 1))
+    {
+        g_is_success = true;
+    }
+    else
+    {
+        g_is_success = false;
+    }
+
+    return pdFALSE;
+}
+
+/******************************************************************************/
+
+#define PIPELINED_SKEW          4
+#define PIPELINED_ROUNDS        12
+#define PIPELINED_DIVERGED_SYNC 7
+
+uint8_t pipelined_cb(CompareValue_t * pxCompareValues, uint8_t ucLen);
+static void task_pipelined(void * unused);
+
+static uint8_t pipelined_started = 0;
+static volatile UBaseType_t pipelined_fast_index = 0;
+static volatile uint32_t pipelined_done[taskREPLICATED_RECOVERY];
+static volatile uint32_t pipelined_max_lead = 0;
+static volatile uint8_t pipelined_calls = 0;
+
+test_status_t test_pipelined_reports_sync_index(void)
+{
+    TaskHandle_t h_replicated = NULL;
+
+    g_is_success = false;
+    pipelined_started = 0;
+    pipelined_max_lead = 0;
+    pipelined_calls = 0;
+    memset((void *)pipelined_done, 0, sizeof(pipelined_done));
+
+    xTaskCreateReplicatedPipelined(task_pipelined,
+                                   "Pipelined",
+                                   configMINIMAL_STACK_SIZE,
+                                   NULL,
+                                   PRIORITY_TEST,
+                                   &h_replicated,
+                                   taskREPLICATED_RECOVERY,
+                                   PIPELINED_SKEW,
+                                   pipelined_cb);
+
+    vTaskDelay(pdMS_TO_TICKS(2 * PIPELINED_ROUNDS * 10));
+
+    if(h_replicated != NULL)
+    {
+        vTaskDelete(h_replicated);
+    }
+
+    /* Fast replica ran ahead, but never more than the skew. One more is
+     * possible while the slower replica is between push and return. Majority
+     * kept the group running after the mismatch. */
+    if(!g_is_success ||
+       pipelined_calls != 1 ||
+       pipelined_done[pipelined_fast_index] != PIPELINED_ROUNDS ||
+       pipelined_max_lead < PIPELINED_SKEW ||
+       pipelined_max_lead > PIPELINED_SKEW + 1)
+    {
+        return TEST_FAIL;
+    }
+
+    return TEST_PASS;
+}
+
+static void task_pipelined(void * unused)
+{
+    const UBaseType_t index = uxTaskGetReplicaIndex(NULL);
+    CompareValue_t value;
+    bool is_fast = false;
+
+    /* First started replica doesn't wait and diverges on one sync point */
+    taskENTER_CRITICAL();
+    if(pipelined_started++ == 0)
+    {
+        is_fast = true;
+        pipelined_fast_index = index;
+    }
+    taskEXIT_CRITICAL();
+
+    for(uint32_t sync = 0; sync < PIPELINED_ROUNDS; sync++)
+    {
+        value = sync;
+        if(is_fast && sync == PIPELINED_DIVERGED_SYNC)
+        {
+            value++;
+        }
+
+        if(!is_fast)
+        {
+            vTaskDelay(pdMS_TO_TICKS(10));
+        }
+
+        vTaskSyncAndCompare(&value);
+
+        taskENTER_CRITICAL();
+        pipelined_done[index]++;
+        for(UBaseType_t iii = 0; iii < taskREPLICATED_RECOVERY; iii++)
+        {
+            if(pipelined_done[index] - pipelined_done[iii] > pipelined_max_lead &&
+               pipelined_done[index] >= pipelined_done[iii])
+            {
+                pipelined_max_lead = pipelined_done[index] - pipelined_done[iii];
+            }
+        }
+        taskEXIT_CRITICAL();
+    }
+
+    vTaskDelay(portMAX_DELAY);
+}
+
+uint8_t pipelined_cb(CompareValue_t * pxCompareValues, uint8_t ucLen)
+{
+    ReplicatedMismatch_t mismatch;
+
+    pipelined_calls++;
+
+    if(xTaskGetReplicatedMismatch(NULL, &mismatch) == pdTRUE &&
+       mismatch.ulSyncIndex == PIPELINED_DIVERGED_SYNC &&
+       mismatch.ulDivergedMask == (1UL << pipelined_fast_index) &&
+       mismatch.xVotedValue == PIPELINED_DIVERGED_SYNC &&
+       mismatch.ucVotes == (taskREPLICATED_RECOVERY - 1))
+    {
+        g_is_success = true;
+    }
+
+    /* One of three diverged, group shall not be deleted */
+    return taskREPLICATED_RESPAWN;
+}
+
+/******************************************************************************/
+
+#define CHECKPOINTS_DIVERGED 1
+
+uint8_t checkpoints_cb(CompareValue_t * pxCompareValues, uint8_t ucLen);
+static void task_checkpoints(void * unused);
+
+static uint8_t checkpoints_started = 0;
+static volatile UBaseType_t checkpoints_diverged_index = 0;
+static volatile uint8_t checkpoints_calls = 0;
+static volatile bool checkpoints_full_failed = true;
+
+test_status_t test_checkpoints_report_first_diverged(void)
+{
+    TaskHandle_t h_replicated = NULL;
+
+    g_is_success = false;
+    checkpoints_started = 0;
+    checkpoints_calls = 0;
+    checkpoints_full_failed = true;
+
+    xTaskCreateReplicated(task_checkpoints,
+                          "Checkpoints",
+                          configMINIMAL_STACK_SIZE,
+                          NULL,
+                          PRIORITY_TEST,
+                          &h_replicated,
+                          taskREPLICATED_RECOVERY,
+                          checkpoints_cb);
+
+    vTaskDelay(pdMS_TO_TICKS(100));
+
+    if(h_replicated != NULL)
+    {
+        vTaskDelete(h_replicated);
+    }
+
+    if(!g_is_success ||
+       !checkpoints_full_failed ||
+       checkpoints_calls != 1)
+    {
+        return TEST_FAIL;
+    }
+
+    return TEST_PASS;
+}
+
+static void task_checkpoints(void * unused)
+{
+    CompareValue_t value = 10;
+    bool is_diverged = false;
+
+    taskENTER_CRITICAL();
+    if(checkpoints_started++ == 0)
+    {
+        is_diverged = true;
+        checkpoints_diverged_index = uxTaskGetReplicaIndex(NULL);
+    }
+    taskEXIT_CRITICAL();
+
+    for(UBaseType_t iii = 0; iii < configMAX_REPLICATED_CHECKPOINTS; iii++)
+    {
+        CompareValue_t checkpoint = 100 + iii;
+
+        /* Checkpoints after the first diverged one differ too, only the
+         * first is reported */
+        if(is_diverged && iii >= CHECKPOINTS_DIVERGED)
+        {
+            checkpoint++;
+        }
+
+        if(xTaskRecordCompareValue(checkpoint) != pdPASS)
+        {
+            checkpoints_full_failed = false;
+        }
+    }
+
+    if(xTaskRecordCompareValue(value) != pdFAIL)
+    {
+        checkpoints_full_failed = false;
+    }
+
+    vTaskSyncAndCompare(&value);
+
+    /* Checkpoints are cleared on the synchronization point */
+    vTaskSyncAndCompare(&value);
+
+    vTaskDelay(portMAX_DELAY);
+}
+
+uint8_t checkpoints_cb(CompareValue_t * pxCompareValues, uint8_t ucLen)
+{
+    ReplicatedMismatch_t mismatch;
+
+    checkpoints_calls++;
+
+    if(xTaskGetReplicatedMismatch(NULL, &mismatch) == pdTRUE &&
+       mismatch.uxCheckpoint == CHECKPOINTS_DIVERGED &&
+       mismatch.ulDivergedMask == (1UL << checkpoints_diverged_index) &&
+       mismatch.xVotedValue == 100 + CHECKPOINTS_DIVERGED &&
+       pxCompareValues[checkpoints_diverged_index] == 100 + CHECKPOINTS_DIVERGED + 1)
+    {
+        g_is_success = true;
+    }
+
+    return pdFALSE;
+}
+
+/******************************************************************************/
+
+uint8_t static_replicated_cb(CompareValue_t * pxCompareValues, uint8_t ucLen);
+static void task_static_replicated(void * unused);
+
+static StackType_t static_replicated_stacks[taskREPLICATED_RECOVERY * configMINIMAL_STACK_SIZE];
+static StaticTask_t static_replicated_tcbs[taskREPLICATED_RECOVERY];
+static StaticReplicatedGroup_t static_replicated_group;
+static uint8_t static_replicated_started = 0;
+
+test_status_t test_static_replicated(void)
+{
+    TaskHandle_t h_replicated = NULL;
+    bool is_in_buffers = false;
+
+    g_is_success = false;
+    static_replicated_started = 0;
+
+    if(xTaskCreateReplicatedStatic(task_static_replicated,
+                                   "Static",
+                                   configMINIMAL_STACK_SIZE,
+                                   NULL,
+                                   PRIORITY_TEST,
+                                   &h_replicated,
+                                   taskREPLICATED_RECOVERY,
+                                   static_replicated_stacks,
+                                   static_replicated_tcbs,
+                                   &static_replicated_group,
+                                   static_replicated_cb) != pdPASS)
+    {
+        return TEST_FAIL;
+    }
+
+    /* Handle is the TCB of the first replica */
+    is_in_buffers = (h_replicated == (TaskHandle_t)&static_replicated_tcbs[0]);
+
+    vTaskDelay(pdMS_TO_TICKS(100));
+
+    if(h_replicated != NULL)
+    {
+        vTaskDelete(h_replicated);
+    }
+
+    return (g_is_success && is_in_buffers) ? TEST_PASS: TEST_FAIL;
+}
+
+static void task_static_replicated(void * unused)
+{
+    CompareValue_t value = 10;
+
+    taskENTER_CRITICAL();
+    if(static_replicated_started++ == 0)
+    {
+        value = 11;
+    }
+    taskEXIT_CRITICAL();
+
+    vTaskSyncAndCompare(&value);
+
+    vTaskDelay(portMAX_DELAY);
+}
+
+uint8_t static_replicated_cb(CompareValue_t * pxCompareValues, uint8_t ucLen)
+{
+    g_is_success = true;
+
+    return pdFALSE;
+}
+
 /******************************************************************************/
 /****END OF FILE****/
@@ -22,6 +22,78 @@
 #undef TIMED_TIMEOUT
 #define TIMED_TIMEOUT 500
 
+#undef TIMED_ORUN_TIMEOUT
+#define TIMED_ORUN_TIMEOUT taskUS_TO_OVERRUN_TIME(TIMED_TIMEOUT * 1000)
+
+#undef SUB_TICK_ORUN_TIMEOUT_US
+#define SUB_TICK_ORUN_TIMEOUT_US 300
+
+#undef STATS_JOBS
+#define STATS_JOBS 4
+
+#undef STATS_JOB_MS
+#define STATS_JOB_MS 2
+
+#undef EDF_EARLY_TIMEOUT
+#define EDF_EARLY_TIMEOUT 60
+
+#undef EDF_LATE_TIMEOUT
+#define EDF_LATE_TIMEOUT 100
+
+#undef EDF_JOB_MS
+#define EDF_JOB_MS 50
+
+#undef DEMOTE_TASK_PRIORITY
+#define DEMOTE_TASK_PRIORITY 3
+
+#undef DEMOTE_ORUN_TIMEOUT
+#define DEMOTE_ORUN_TIMEOUT taskUS_TO_OVERRUN_TIME(10 * 1000)
+
+#undef DEMOTE_PERIOD
+#define DEMOTE_PERIOD 50
+
+#undef PERIODIC_PERIOD
+#define PERIODIC_PERIOD 20
+
+#undef PERIODIC_DEADLINE
+#define PERIODIC_DEADLINE 15
+
+#undef PERIODIC_JOBS
+#define PERIODIC_JOBS 5
+
+#undef PERIODIC_JOB_MS
+#define PERIODIC_JOB_MS 2
+
+#undef LATENCY_ORUN_MS
+#define LATENCY_ORUN_MS 5
+
+#undef SUPERVISOR_PRIORITY
+#define SUPERVISOR_PRIORITY (configMAX_PRIORITIES - 1)
+
+#undef HI_TASK_PRIORITY
+#define HI_TASK_PRIORITY 3
+
+#undef HI_ORUN_LO_MS
+#define HI_ORUN_LO_MS 5
+
+#undef HI_ORUN_HI_MS
+#define HI_ORUN_HI_MS 50
+
+#undef HI_JOB_MS
+#define HI_JOB_MS 10
+
+#undef WARNING_ORUN_MS
+#define WARNING_ORUN_MS 20
+
+#undef WARNING_LONG_JOB_MS
+#define WARNING_LONG_JOB_MS 17
+
+#undef WARNING_SHORT_JOB_MS
+#define WARNING_SHORT_JOB_MS 5
+
+#undef WARNING_LONG_JOBS
+#define WARNING_LONG_JOBS 3
+
 
 /******************************************************************************/
 
@@ -39,6 +111,54 @@ void task_faster_orun(void * unused);
 void slower_orun_timeout_cb(WorstTimeTimerHandle_t h_timer);
 void faster_orun_timeout_cb(WorstTimeTimerHandle_t h_timer);
 
+test_status_t test_static_slower_than_oflow_timeout();
+
+test_status_t test_orun_demote();
+void task_orun_demote(void * unused);
+void demote_orun_timeout_cb(WorstTimeTimerHandle_t h_timer);
+
+test_status_t test_periodic();
+void task_periodic(void * unused);
+void periodic_deadline_miss_cb(WorstTimeTimerHandle_t h_timer);
+
+#if ( configTIMED_BUDGET_IN_RUN_TIME_COUNTS == 1 )
+test_status_t test_sub_tick_orun_timeout();
+void task_sub_tick_orun(void * unused);
+void sub_tick_orun_timeout_cb(WorstTimeTimerHandle_t h_timer);
+#endif
+
+#if ( configUSE_TIMED_TASK_STATS == 1 )
+test_status_t test_timed_stats();
+void task_timed_stats(void * unused);
+#endif
+
+#if ( configUSE_TIMED_EDF == 1 )
+test_status_t test_edf_order();
+void task_edf_early(void * unused);
+void task_edf_late(void * unused);
+void edf_oflow_timeout_cb(WorstTimeTimerHandle_t h_timer);
+#endif
+
+#if ( configUSE_TIMED_SUPERVISOR == 1 )
+test_status_t test_supervisor_latency();
+void task_latency(void * unused);
+void latency_orun_timeout_cb(WorstTimeTimerHandle_t h_timer);
+void task_supervisor(void * unused);
+#endif
+
+#if ( configUSE_TIMED_CRITICALITY == 1 )
+test_status_t test_criticality_mode();
+void task_criticality_lo(void * unused);
+void task_criticality_hi(void * unused);
+void criticality_orun_timeout_cb(WorstTimeTimerHandle_t h_timer);
+#endif
+
+#if ( configUSE_TIMED_BUDGET_WARNING == 1 )
+test_status_t test_budget_warning();
+void task_budget_warning(void * unused);
+void warning_orun_timeout_cb(WorstTimeTimerHandle_t h_timer);
+#endif
+
 /******************************************************************************/
 
 static volatile bool g_is_success;
@@ -62,6 +182,54 @@ void tests_timed_task(void)
     ndebug_printf("    Test faster than overrun timeout...%s\n",
                   test_faster_than_orun_timeout() == TEST_PASS?
                   "OK": "FAIL");
+
+    ndebug_printf("    Test static slower than overflow timeout...%s\n",
+                  test_static_slower_than_oflow_timeout() == TEST_PASS?
+                  "OK": "FAIL");
+
+    ndebug_printf("    Test overrun demote...%s\n",
+                  test_orun_demote() == TEST_PASS?
+                  "OK": "FAIL");
+
+    ndebug_printf("    Test periodic...%s\n",
+                  test_periodic() == TEST_PASS?
+                  "OK": "FAIL");
+
+#if ( configTIMED_BUDGET_IN_RUN_TIME_COUNTS == 1 )
+    ndebug_printf("    Test sub tick overrun timeout...%s\n",
+                  test_sub_tick_orun_timeout() == TEST_PASS?
+                  "OK": "FAIL");
+#endif
+
+#if ( configUSE_TIMED_TASK_STATS == 1 )
+    ndebug_printf("    Test timed stats...%s\n",
+                  test_timed_stats() == TEST_PASS?
+                  "OK": "FAIL");
+#endif
+
+#if ( configUSE_TIMED_EDF == 1 )
+    ndebug_printf("    Test EDF order...%s\n",
+                  test_edf_order() == TEST_PASS?
+                  "OK": "FAIL");
+#endif
+
+#if ( configUSE_TIMED_SUPERVISOR == 1 )
+    ndebug_printf("    Test supervisor latency...%s\n",
+                  test_supervisor_latency() == TEST_PASS?
+                  "OK": "FAIL");
+#endif
+
+#if ( configUSE_TIMED_CRITICALITY == 1 )
+    ndebug_printf("    Test criticality mode...%s\n",
+                  test_criticality_mode() == TEST_PASS?
+                  "OK": "FAIL");
+#endif
+
+#if ( configUSE_TIMED_BUDGET_WARNING == 1 )
+    ndebug_printf("    Test budget warning...%s\n",
+                  test_budget_warning() == TEST_PASS?
+                  "OK": "FAIL");
+#endif
 }
 
 /******************************************************************************/
@@ -161,7 +329,7 @@ test_status_t test_slower_than_orun_timeout()
                      NULL,
                      TEST_TASK_PRIORITY,
                      &h_timed,
-                     TIMED_TIMEOUT,
+                     TIMED_ORUN_TIMEOUT,
                      slower_orun_timeout_cb,
                      0,
                      NULL
@@ -204,7 +372,7 @@ test_status_t test_faster_than_orun_timeout()
                      NULL,
                      TEST_TASK_PRIORITY,
                      &h_timed,
-                     TIMED_TIMEOUT,
+                     TIMED_ORUN_TIMEOUT,
                      slower_orun_timeout_cb,
                      0,
                      NULL
@@ -232,5 +400,655 @@ void faster_orun_timeout_cb(WorstTimeTimerHandle_t h_timer)
 {
     g_is_success = false;
 }
+/******************************************************************************/
+
+static StackType_t static_timed_stack[configMINIMAL_STACK_SIZE];
+static StaticTask_t static_timed_tcb;
+static StaticTimer_t static_timed_oflow_timer;
+
+test_status_t test_static_slower_than_oflow_timeout()
+{
+    TaskHandle_t h_timed = NULL;
+
+    g_is_success = false;
+
+    h_timed = xTaskCreateTimedStatic(task_slower_oflow,
+                                     "static",
+                                     configMINIMAL_STACK_SIZE,
+                                     NULL,
+                                     TEST_TASK_PRIORITY,
+                                     static_timed_stack,
+                                     &static_timed_tcb,
+                                     0,
+                                     NULL,
+                                     NULL,
+                                     TIMED_TIMEOUT,
+                                     slower_oflow_timeout_cb,
+                                     &static_timed_oflow_timer);
+
+    vTaskDelay(TIMED_TIMEOUT + 50);
+
+    if(h_timed)
+    {
+        vTaskDelete(h_timed);
+    }
+
+    return g_is_success ? TEST_PASS : TEST_FAIL;
+}
+
+/******************************************************************************/
+
+test_status_t test_orun_demote()
+{
+    TaskHandle_t h_timed = NULL;
+
+    g_is_success = false;
+
+    /* Task runs above this one and never blocks */
+    xTaskCreateTimed(task_orun_demote,
+                     "demote",
+                     configMINIMAL_STACK_SIZE,
+                     NULL,
+                     DEMOTE_TASK_PRIORITY,
+                     &h_timed,
+                     DEMOTE_ORUN_TIMEOUT,
+                     demote_orun_timeout_cb,
+                     0,
+                     NULL);
+
+    /* Returns only if the task was demoted */
+    vTaskDelay(DEMOTE_PERIOD * 2);
+
+    if(h_timed)
+    {
+        vTaskDelete(h_timed);
+    }
+
+    return g_is_success ? TEST_PASS : TEST_FAIL;
+}
+
+void task_orun_demote(void * unused)
+{
+    xTaskTimedSetEnforcement(NULL, eTimedEnforceDemote, DEMOTE_PERIOD);
+
+    while(true)
+    {
+    }
+}
+
+void demote_orun_timeout_cb(WorstTimeTimerHandle_t h_timer)
+{
+    g_is_success = true;
+}
+
+/******************************************************************************/
+
+static volatile uint32_t g_periodic_jobs;
+
+test_status_t test_periodic()
+{
+    TaskHandle_t h_timed = NULL;
+    bool is_stats_ok = true;
+
+    g_is_success = true;
+    g_periodic_jobs = 0;
+
+    xTaskCreateTimedPeriodic(task_periodic,
+                             "periodic",
+                             configMINIMAL_STACK_SIZE,
+                             NULL,
+                             TEST_TASK_PRIORITY,
+                             &h_timed,
+                             PERIODIC_PERIOD,
+                             0,
+                             NULL,
+                             PERIODIC_DEADLINE,
+                             periodic_deadline_miss_cb);
+
+    vTaskDelay(PERIODIC_PERIOD * PERIODIC_JOBS + PERIODIC_PERIOD / 2);
+
+#if ( configUSE_TIMED_TASK_STATS == 1 )
+    TimedStats_t stats;
+
+    xTaskGetTimedStats(h_timed, &stats);
+
+    /* Only this task runs at its priority, so releases are on time */
+    is_stats_ok = ((stats.ulJobs >= PERIODIC_JOBS) &&
+                   (stats.ulDeadlineMisses == 0) &&
+                   (stats.ulJitterMax == 0) &&
+                   (stats.ulLatencyMean <= stats.ulLatencyMax) &&
+                   (stats.ulResponseMean <= stats.ulResponseMax) &&
+                   (stats.ulLatencyMax <= stats.ulResponseMax));
+#endif
+
+    if(h_timed)
+    {
+        vTaskDelete(h_timed);
+    }
+
+    return (g_is_success &&
+            is_stats_ok &&
+            (g_periodic_jobs >= PERIODIC_JOBS)) ? TEST_PASS : TEST_FAIL;
+}
+
+void task_periodic(void * unused)
+{
+    while(true)
+    {
+        HAL_Delay(PERIODIC_JOB_MS);
+        g_periodic_jobs++;
+        vTaskTimedWaitForNextPeriod();
+    }
+}
+
+void periodic_deadline_miss_cb(WorstTimeTimerHandle_t h_timer)
+{
+    g_is_success = false;
+}
+
+/******************************************************************************/
+
+#if ( configTIMED_BUDGET_IN_RUN_TIME_COUNTS == 1 )
+
+static volatile bool g_is_orun_called;
+
+test_status_t test_sub_tick_orun_timeout()
+{
+    TaskHandle_t h_timed = NULL;
+
+    g_is_success = false;
+    g_is_orun_called = false;
+
+    xTaskCreateTimed(task_sub_tick_orun,
+                     "sub tick",
+                     configMINIMAL_STACK_SIZE,
+                     NULL,
+                     TEST_TASK_PRIORITY,
+                     &h_timed,
+                     taskUS_TO_OVERRUN_TIME(SUB_TICK_ORUN_TIMEOUT_US),
+                     sub_tick_orun_timeout_cb,
+                     0,
+                     NULL);
+
+    vTaskDelay(TIMED_TIMEOUT);
+
+    if(h_timed)
+    {
+        vTaskDelete(h_timed);
+    }
+
+    return g_is_success ? TEST_PASS : TEST_FAIL;
+}
+
+void task_sub_tick_orun(void * unused)
+{
+    TickType_t start;
+
+    /* Start right after a tick, so the overrun is within the same tick. */
+    start = xTaskGetTickCount();
+    while(xTaskGetTickCount() == start)
+    {
+    }
+
+    vTaskTimedReset(NULL);
+    start = xTaskGetTickCount();
+
+    while((g_is_orun_called == false) && (xTaskGetTickCount() == start))
+    {
+    }
+
+    g_is_success = g_is_orun_called;
+    vTaskDelay(portMAX_DELAY);
+}
+
+void sub_tick_orun_timeout_cb(WorstTimeTimerHandle_t h_timer)
+{
+    g_is_orun_called = true;
+}
+
+#endif
+
+/******************************************************************************/
+
+#if ( configUSE_TIMED_TASK_STATS == 1 )
+
+test_status_t test_timed_stats()
+{
+    TaskHandle_t h_timed = NULL;
+    TimedStats_t stats;
+    uint32_t bucket_jobs = 0;
+    uint32_t min_counts = (configRUN_TIME_COUNTER_HZ / 1000) * (STATS_JOB_MS - 1);
+
+    xTaskCreateTimed(task_timed_stats,
+                     "stats",
+                     configMINIMAL_STACK_SIZE,
+                     NULL,
+                     TEST_TASK_PRIORITY,
+                     &h_timed,
+                     0,
+                     NULL,
+                     0,
+                     NULL);
+
+    vTaskDelay(STATS_JOBS * STATS_JOB_MS * 10);
+
+    xTaskGetTimedStats(h_timed, &stats);
+
+    if(h_timed)
+    {
+        vTaskDelete(h_timed);
+    }
+
+    for(uint32_t i = 0; i < configTIMED_TASK_STATS_BUCKETS; i++)
+    {
+        bucket_jobs += stats.ulBuckets[i];
+    }
+
+    return ((stats.ulJobs == STATS_JOBS) &&
+            (bucket_jobs == STATS_JOBS) &&
+            (stats.ulMin >= min_counts) &&
+            (stats.ulMin <= stats.ulMean) &&
+            (stats.ulMean <= stats.ulMax) &&
+            (stats.ulMax <= stats.ulWcet)) ? TEST_PASS : TEST_FAIL;
+}
+
+void task_timed_stats(void * unused)
+{
+    for(uint32_t i = 0; i < STATS_JOBS; i++)
+    {
+        HAL_Delay(STATS_JOB_MS);
+        vTaskTimedReset(NULL);
+    }
+
+    vTaskDelay(portMAX_DELAY);
+}
+
+#endif
+
+/******************************************************************************/
+
+#if ( configUSE_TIMED_EDF == 1 )
+
+static volatile char g_edf_order[4];
+static volatile uint8_t g_edf_runs;
+
+test_status_t test_edf_order()
+{
+    TaskHandle_t h_early = NULL;
+    TaskHandle_t h_late = NULL;
+
+    g_edf_runs = 0;
+
+    /* Late task is created first, so it would run first with round robin */
+    vTaskSuspendAll();
+
+    xTaskCreateTimed(task_edf_late,
+                     "edf_late",
+                     configMINIMAL_STACK_SIZE,
+                     NULL,
+                     configTIMED_EDF_PRIORITY,
+                     &h_late,
+                     0,
+                     NULL,
+                     EDF_LATE_TIMEOUT,
+                     edf_oflow_timeout_cb);
+
+    xTaskCreateTimed(task_edf_early,
+                     "edf_early",
+                     configMINIMAL_STACK_SIZE,
+                     NULL,
+                     configTIMED_EDF_PRIORITY,
+                     &h_early,
+                     0,
+                     NULL,
+                     EDF_EARLY_TIMEOUT,
+                     edf_oflow_timeout_cb);
+
+    xTaskResumeAll();
+
+    vTaskDelay(EDF_LATE_TIMEOUT * 2);
+
+    if(h_early)
+    {
+        vTaskDelete(h_early);
+    }
+
+    if(h_late)
+    {
+        vTaskDelete(h_late);
+    }
+
+    /* Reset moves the deadline of early task after the late one */
+    return ((g_edf_runs == 3) &&
+            (g_edf_order[0] == 'E') &&
+            (g_edf_order[1] == 'L') &&
+            (g_edf_order[2] == 'E')) ? TEST_PASS : TEST_FAIL;
+}
+
+void task_edf_early(void * unused)
+{
+    g_edf_order[g_edf_runs++] = 'E';
+
+    HAL_Delay(EDF_JOB_MS);
+    vTaskTimedReset(NULL);
+
+    g_edf_order[g_edf_runs++] = 'E';
+
+    vTaskDelay(portMAX_DELAY);
+}
+
+void task_edf_late(void * unused)
+{
+    g_edf_order[g_edf_runs++] = 'L';
+
+    vTaskDelay(portMAX_DELAY);
+}
+
+void edf_oflow_timeout_cb(WorstTimeTimerHandle_t h_timer)
+{
+}
+
+#endif
+
+/******************************************************************************/
+
+#if ( configUSE_TIMED_SUPERVISOR == 1 )
+
+typedef struct
+{
+    TickType_t ticks;
+    uint32_t counts;
+} latency_t;
+
+static volatile bool g_is_orun_handled;
+static volatile latency_t g_orun_start;
+static volatile latency_t g_orun_handled;
+static TaskHandle_t g_h_latency;
+
+static void latency_now(volatile latency_t * p_latency)
+{
+    p_latency->ticks = xTaskGetTickCount();
+#if ( configGENERATE_RUN_TIME_STATS == 1 )
+    p_latency->counts = portGET_RUN_TIME_COUNTER_VALUE();
+#else
+    p_latency->counts = 0;
+#endif
+}
+
+/* Time from the moment the budget ran out until it was handled */
+static test_status_t measure_latency(latency_t * p_latency)
+{
+    g_is_orun_handled = false;
+
+    xTaskCreateTimed(task_latency,
+                     "latency",
+                     configMINIMAL_STACK_SIZE,
+                     NULL,
+                     TEST_TASK_PRIORITY,
+                     &g_h_latency,
+                     taskUS_TO_OVERRUN_TIME(LATENCY_ORUN_MS * 1000),
+                     latency_orun_timeout_cb,
+                     0,
+                     NULL);
+
+    vTaskDelay(LATENCY_ORUN_MS * 10);
+
+    if(g_h_latency)
+    {
+        vTaskDelete(g_h_latency);
+    }
+
+    p_latency->ticks = g_orun_handled.ticks - g_orun_start.ticks -
+                       pdMS_TO_TICKS(LATENCY_ORUN_MS);
+#if ( configGENERATE_RUN_TIME_STATS == 1 )
+    p_latency->counts = g_orun_handled.counts - g_orun_start.counts -
+                        (configRUN_TIME_COUNTER_HZ / 1000) * LATENCY_ORUN_MS;
+#else
+    p_latency->counts = 0;
+#endif
+
+    return g_is_orun_handled ? TEST_PASS : TEST_FAIL;
+}
+
+test_status_t test_supervisor_latency()
+{
+    TaskHandle_t h_supervisor = NULL;
+    latency_t daemon;
+    latency_t supervisor;
+    test_status_t status;
+
+    status = measure_latency(&daemon);
+
+    xTaskCreate(task_supervisor,
+                "supervisor",
+                configMINIMAL_STACK_SIZE,
+                NULL,
+                SUPERVISOR_PRIORITY,
+                &h_supervisor);
+    vTaskTimedSetSupervisor(h_supervisor);
+
+    if(measure_latency(&supervisor) != TEST_PASS)
+    {
+        status = TEST_FAIL;
+    }
+
+    vTaskTimedSetSupervisor(NULL);
+
+    if(h_supervisor)
+    {
+        vTaskDelete(h_supervisor);
+    }
+
+    ndebug_printf("      Overrun latency daemon %lu ticks %lu counts, "
+                  "supervisor %lu ticks %lu counts\n",
+                  (unsigned long)daemon.ticks, (unsigned long)daemon.counts,
+                  (unsigned long)supervisor.ticks,
+                  (unsigned long)supervisor.counts);
+
+    /* Supervisor skips the timer service task, so it is never later */
+    if((supervisor.ticks > daemon.ticks) || (supervisor.counts > daemon.counts))
+    {
+        status = TEST_FAIL;
+    }
+
+    return status;
+}
+
+void task_latency(void * unused)
+{
+    TickType_t start;
+
+    /* Budget starts right after a tick, so the tick budget isn't short */
+    start = xTaskGetTickCount();
+    while(xTaskGetTickCount() == start)
+    {
+    }
+
+    vTaskTimedReset(NULL);
+    latency_now(&g_orun_start);
+
+    while((g_is_orun_handled == false) &&
+          (xTaskGetTickCount() - g_orun_start.ticks < LATENCY_ORUN_MS * 4))
+    {
+    }
+
+    vTaskDelay(portMAX_DELAY);
+}
+
+void latency_orun_timeout_cb(WorstTimeTimerHandle_t h_timer)
+{
+    if(g_is_orun_handled == false)
+    {
+        latency_now(&g_orun_handled);
+        g_is_orun_handled = true;
+    }
+}
+
+void task_supervisor(void * unused)
+{
+    TimedEvent_t event;
+
+    while(true)
+    {
+        if((xTaskTimedReceiveEvent(&event, portMAX_DELAY) == pdPASS) &&
+           (event.xTask == g_h_latency) &&
+           (event.eEvent == eTimedEventOverrun) &&
+           (g_is_orun_handled == false))
+        {
+            latency_now(&g_orun_handled);
+            g_is_orun_handled = true;
+        }
+    }
+}
+
+#endif
+
+/******************************************************************************/
+
+#if ( configUSE_TIMED_CRITICALITY == 1 )
+
+static volatile bool g_is_hi_orun_called;
+static volatile bool g_is_hi_mode_ok;
+static TaskHandle_t g_h_criticality_lo;
+
+test_status_t test_criticality_mode()
+{
+    TaskHandle_t h_hi = NULL;
+    bool is_lo_restored;
+
+    g_is_hi_orun_called = false;
+    g_is_hi_mode_ok = false;
+
+    xTaskCreateTimed(task_criticality_lo,
+                     "crit_lo",
+                     configMINIMAL_STACK_SIZE,
+                     NULL,
+                     TEST_TASK_PRIORITY,
+                     &g_h_criticality_lo,
+                     0,
+                     NULL,
+                     0,
+                     NULL);
+    xTaskTimedSetCriticality(g_h_criticality_lo, eTimedCriticalityLo, 0);
+
+    xTaskCreateTimed(task_criticality_hi,
+                     "crit_hi",
+                     configMINIMAL_STACK_SIZE,
+                     NULL,
+                     HI_TASK_PRIORITY,
+                     &h_hi,
+                     taskUS_TO_OVERRUN_TIME(HI_ORUN_LO_MS * 1000),
+                     criticality_orun_timeout_cb,
+                     0,
+                     NULL);
+
+    /* HI task is done and the idle task ran at least once since */
+    vTaskDelay(HI_JOB_MS * 5);
+
+    is_lo_restored = (eTaskTimedGetMode() == eTimedCriticalityLo) &&
+                     (uxTaskPriorityGet(g_h_criticality_lo) == TEST_TASK_PRIORITY);
+
+    if(h_hi)
+    {
+        vTaskDelete(h_hi);
+    }
+
+    if(g_h_criticality_lo)
+    {
+        vTaskDelete(g_h_criticality_lo);
+    }
+
+    return (g_is_hi_mode_ok &&
+            is_lo_restored &&
+            (g_is_hi_orun_called == false)) ? TEST_PASS : TEST_FAIL;
+}
+
+void task_criticality_lo(void * unused)
+{
+    while(true)
+    {
+    }
+}
+
+void task_criticality_hi(void * unused)
+{
+    xTaskTimedSetCriticality(NULL,
+                             eTimedCriticalityHi,
+                             taskUS_TO_OVERRUN_TIME(HI_ORUN_HI_MS * 1000));
+
+    /* Runs over the LO budget, but within the HI one */
+    HAL_Delay(HI_JOB_MS);
+
+    g_is_hi_mode_ok = (eTaskTimedGetMode() == eTimedCriticalityHi) &&
+                      (uxTaskPriorityGet(g_h_criticality_lo) == configTIMED_HI_MODE_LO_PRIORITY);
+
+    vTaskTimedReset(NULL);
+    vTaskDelay(portMAX_DELAY);
+}
+
+void criticality_orun_timeout_cb(WorstTimeTimerHandle_t h_timer)
+{
+    g_is_hi_orun_called = true;
+}
+
+#endif
+
+/******************************************************************************/
+
+#if ( configUSE_TIMED_BUDGET_WARNING == 1 )
+
+test_status_t test_budget_warning()
+{
+    TaskHandle_t h_timed = NULL;
+    uint32_t warnings = 0;
+
+    g_is_success = true;
+
+    xTaskCreateTimed(task_budget_warning,
+                     "warning",
+                     configMINIMAL_STACK_SIZE,
+                     NULL,
+                     TEST_TASK_PRIORITY,
+                     &h_timed,
+                     taskUS_TO_OVERRUN_TIME(WARNING_ORUN_MS * 1000),
+                     warning_orun_timeout_cb,
+                     0,
+                     NULL);
+
+    vTaskDelay((WARNING_LONG_JOB_MS + WARNING_SHORT_JOB_MS) *
+               WARNING_LONG_JOBS * 2);
+
+    if(h_timed)
+    {
+        warnings = ulTaskTimedGetBudgetWarnings(h_timed);
+        vTaskDelete(h_timed);
+    }
+
+    /* Only the long jobs pass the threshold, each of them once */
+    return (g_is_success && (warnings == WARNING_LONG_JOBS)) ?
+           TEST_PASS : TEST_FAIL;
+}
+
+void task_budget_warning(void * unused)
+{
+    for(uint32_t i = 0; i < WARNING_LONG_JOBS; i++)
+    {
+        HAL_Delay(WARNING_LONG_JOB_MS);
+        vTaskTimedReset(NULL);
+
+        HAL_Delay(WARNING_SHORT_JOB_MS);
+        vTaskTimedReset(NULL);
+    }
+
+    vTaskDelay(portMAX_DELAY);
+}
+
+void warning_orun_timeout_cb(WorstTimeTimerHandle_t h_timer)
+{
+    g_is_success = false;
+}
+
+#endif
+
 /******************************************************************************/
 /****END OF FILE****/
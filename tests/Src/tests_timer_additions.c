@@ -6,6 +6,7 @@
 #include "tests_timer_additions.h"
 
 #include <FreeRTOS.h>
+#include <task.h>
 #include <timers.h>
 
 #include <stdbool.h>
@@ -18,6 +19,27 @@ TimerHandle_t h_timer = NULL;
 
 static bool is_cb_triggered = false;
 
+/* Periods span several levels of the timer wheel */
+static const TickType_t order_periods[] = {1200, 3, 300, 17, 4000, 40, 1};
+#define ORDER_TIMERS (sizeof(order_periods) / sizeof(order_periods[0]))
+#define ORDER_STOPPED 2 /* Index of the timer stopped before it expires */
+
+static TickType_t order_expired[ORDER_TIMERS];
+
+/* The first timer may be late enough to expire together with the second */
+#define SLACK_TIMERS 2
+static const TickType_t slack_periods[SLACK_TIMERS] = {100, 120};
+static const TickType_t slack_ticks[SLACK_TIMERS]   = {50, 0};
+
+/* The callback of the first lane is busy longer than the period of the timer
+ * in the kernel lane */
+#define LANE_SLOW_PERIOD 10
+#define LANE_SLOW_BUSY   50
+#define LANE_FAST_PERIOD 20
+
+static TickType_t lane_expired = 0;
+static TaskHandle_t lane_task = NULL;
+
 /******************************************************************************/
 
 void timer_cb(TimerHandle_t h_timer)
@@ -25,12 +47,36 @@ void timer_cb(TimerHandle_t h_timer)
     is_cb_triggered = true;
 }
 
+void order_timer_cb(TimerHandle_t h_timer)
+{
+    order_expired[(uint32_t)pvTimerGetTimerID(h_timer)] = xTaskGetTickCount();
+}
+
+void lane_slow_timer_cb(TimerHandle_t h_timer)
+{
+    TickType_t start = xTaskGetTickCount();
+
+    while(xTaskGetTickCount() - start < LANE_SLOW_BUSY)
+    {
+    }
+}
+
+void lane_fast_timer_cb(TimerHandle_t h_timer)
+{
+    lane_expired = xTaskGetTickCount();
+    lane_task = xTaskGetCurrentTaskHandle();
+}
+
 /******************************************************************************/
 
 static test_status_t test_start            (void);
 static test_status_t test_pause_resume     (void);
 static test_status_t test_pause_stop_resume(void);
 static test_status_t test_pause_start      (void);
+static test_status_t test_expiry_order     (void);
+static test_status_t test_coalesce         (void);
+static test_status_t test_slack            (void);
+static test_status_t test_lanes            (void);
 
 /******************************************************************************/
 
@@ -57,9 +103,27 @@ void tests_timer_add_task(void)
     ndebug_printf("   Pause, resume...%s\n",
                   test_pause_resume() == TEST_PASS?
                   "OK": "FAIL");
+#if ( configUSE_TIMER_COMMAND_COALESCING == 1 )
+    ndebug_printf("   Coalesced resets, pause and resume...%s\n",
+                  test_coalesce() == TEST_PASS?
+                  "OK": "FAIL");
+#endif
 
     xTimerDelete(h_timer, portMAX_DELAY);
 
+    ndebug_printf("   Expiry time of many timers...%s\n",
+                  test_expiry_order() == TEST_PASS?
+                  "OK": "FAIL");
+#if ( configUSE_TIMER_SLACK == 1 )
+    ndebug_printf("   Timers with slack...%s\n",
+                  test_slack() == TEST_PASS?
+                  "OK": "FAIL");
+#endif
+#if ( configTIMER_SERVICE_LANES > 1 )
+    ndebug_printf("   Timer service lanes...%s\n",
+                  test_lanes() == TEST_PASS?
+                  "OK": "FAIL");
+#endif
 }
 
 /******************************************************************************/
@@ -175,4 +239,212 @@ static test_status_t test_pause_start(void)
     return TEST_FAIL;
 }
 
+/******************************************************************************/
+
+static test_status_t test_coalesce(void)
+{
+    bool is_success = true;
+
+    is_cb_triggered = false;
+    xTimerStart(h_timer, portMAX_DELAY);
+    vTaskDelay(pdMS_TO_TICKS(100));
+
+    /* Far more resets than the command queue holds, while the daemon can't
+     * process any. Pause and resume at the same tick leave the timer as is. */
+    vTaskSuspendAll();
+    for(uint8_t iii = 0; iii < 5 * configTIMER_QUEUE_LENGTH; iii++)
+    {
+        is_success &= (xTimerReset(h_timer, 0) == pdPASS);
+    }
+    xTaskResumeAll();
+
+    TickType_t expiry = xTimerGetExpiryTime(h_timer);
+
+    vTaskSuspendAll();
+    is_success &= (xTimerPause(h_timer, 0) == pdPASS);
+    is_success &= (xTimerResume(h_timer, 0) == pdPASS);
+    xTaskResumeAll();
+
+    is_success &= (xTimerGetExpiryTime(h_timer) == expiry);
+
+    vTaskDelay(pdMS_TO_TICKS(900));
+    is_success &= !is_cb_triggered;
+
+    vTaskDelay(pdMS_TO_TICKS(200));
+    is_success &= is_cb_triggered;
+
+    xTimerStop(h_timer, portMAX_DELAY);
+
+    return is_success? TEST_PASS : TEST_FAIL;
+}
+
+/******************************************************************************/
+
+static test_status_t test_expiry_order(void)
+{
+    TimerHandle_t h_timers[ORDER_TIMERS] = {NULL};
+    bool is_success = true;
+
+    for(uint32_t iii = 0; iii < ORDER_TIMERS; iii++)
+    {
+        order_expired[iii] = 0;
+        h_timers[iii] = xTimerCreate("Order timer",
+                                     order_periods[iii],
+                                     pdFALSE, (void *)iii,
+                                     order_timer_cb);
+        if(h_timers[iii] == NULL)
+        {
+            is_success = false;
+        }
+    }
+
+    if(is_success)
+    {
+        /* All timers are started at the same tick */
+        vTaskSuspendAll();
+        TickType_t start = xTaskGetTickCount();
+        for(uint32_t iii = 0; iii < ORDER_TIMERS; iii++)
+        {
+            xTimerStart(h_timers[iii], 0);
+        }
+        xTaskResumeAll();
+
+        vTaskDelay(order_periods[ORDER_STOPPED] / 2);
+        xTimerStop(h_timers[ORDER_STOPPED], portMAX_DELAY);
+
+        vTaskDelay(4000 + 10);
+
+        for(uint32_t iii = 0; iii < ORDER_TIMERS; iii++)
+        {
+            TickType_t expected = (iii == ORDER_STOPPED)? 0: start + order_periods[iii];
+
+            if(order_expired[iii] != expected)
+            {
+                is_success = false;
+            }
+        }
+    }
+
+    for(uint32_t iii = 0; iii < ORDER_TIMERS; iii++)
+    {
+        if(h_timers[iii] != NULL)
+        {
+            xTimerDelete(h_timers[iii], portMAX_DELAY);
+        }
+    }
+
+    return is_success? TEST_PASS : TEST_FAIL;
+}
+
+/******************************************************************************/
+
+static test_status_t test_slack(void)
+{
+    TimerHandle_t h_timers[SLACK_TIMERS] = {NULL};
+    bool is_success = true;
+
+    for(uint32_t iii = 0; iii < SLACK_TIMERS; iii++)
+    {
+        order_expired[iii] = 0;
+        h_timers[iii] = xTimerCreate("Slack timer",
+                                     slack_periods[iii],
+                                     pdFALSE, (void *)iii,
+                                     order_timer_cb);
+        if(h_timers[iii] == NULL)
+        {
+            is_success = false;
+        }
+        else
+        {
+            vTimerSetSlack(h_timers[iii], slack_ticks[iii]);
+            is_success &= (xTimerGetSlack(h_timers[iii]) == slack_ticks[iii]);
+        }
+    }
+
+    if(is_success)
+    {
+        vTaskSuspendAll();
+        TickType_t start = xTaskGetTickCount();
+        for(uint32_t iii = 0; iii < SLACK_TIMERS; iii++)
+        {
+            xTimerStart(h_timers[iii], 0);
+        }
+        xTaskResumeAll();
+
+        vTaskDelay(slack_periods[SLACK_TIMERS - 1] + 10);
+
+        /* Both callbacks are called in the wakeup of the second timer */
+        for(uint32_t iii = 0; iii < SLACK_TIMERS; iii++)
+        {
+            if(order_expired[iii] != start + slack_periods[SLACK_TIMERS - 1])
+            {
+                is_success = false;
+            }
+        }
+    }
+
+    for(uint32_t iii = 0; iii < SLACK_TIMERS; iii++)
+    {
+        if(h_timers[iii] != NULL)
+        {
+            xTimerDelete(h_timers[iii], portMAX_DELAY);
+        }
+    }
+
+    return is_success? TEST_PASS : TEST_FAIL;
+}
+
+/******************************************************************************/
+
+static test_status_t test_lanes(void)
+{
+    bool is_success = true;
+
+    TimerHandle_t h_slow = xTimerCreate("Slow timer",
+                                        LANE_SLOW_PERIOD,
+                                        pdFALSE, NULL,
+                                        lane_slow_timer_cb);
+    TimerHandle_t h_fast = xTimerCreate("Fast timer",
+                                        LANE_FAST_PERIOD,
+                                        pdFALSE, NULL,
+                                        lane_fast_timer_cb);
+
+    if((h_slow == NULL) || (h_fast == NULL))
+    {
+        is_success = false;
+    }
+    else
+    {
+        vTimerSetLane(h_fast, configTIMER_KERNEL_LANE);
+        is_success &= (uxTimerGetLane(h_slow) == 0);
+        is_success &= (uxTimerGetLane(h_fast) == configTIMER_KERNEL_LANE);
+
+        lane_expired = 0;
+        lane_task = NULL;
+
+        vTaskSuspendAll();
+        TickType_t start = xTaskGetTickCount();
+        xTimerStart(h_slow, 0);
+        xTimerStart(h_fast, 0);
+        xTaskResumeAll();
+
+        vTaskDelay(LANE_SLOW_PERIOD + LANE_SLOW_BUSY + 10);
+
+        /* The busy callback of lane 0 doesn't delay the kernel lane */
+        is_success &= (lane_expired == start + LANE_FAST_PERIOD);
+        is_success &= (lane_task == xTimerGetLaneTaskHandle(configTIMER_KERNEL_LANE));
+    }
+
+    if(h_slow != NULL)
+    {
+        xTimerDelete(h_slow, portMAX_DELAY);
+    }
+    if(h_fast != NULL)
+    {
+        xTimerDelete(h_fast, portMAX_DELAY);
+    }
+
+    return is_success? TEST_PASS : TEST_FAIL;
+}
+
 /****END OF FILE****/
@@ -243,8 +243,158 @@ extern "C" {
         #error If INCLUDE_xTaskCreateTimed is defined configUSE_TIMERS must be set to 1.
     #endif
 
-    #if configSUPPORT_DYNAMIC_ALLOCATION != 1
-        #error If INCLUDE_xTaskCreateTimed is defined configSUPPORT_DYNAMIC_ALLOCATION must be set to 1.
+    /* Set to 1 to count overrun time in units of the run time counter
+    instead of ticks, see xTaskCreateTimed(). */
+    #ifndef configTIMED_BUDGET_IN_RUN_TIME_COUNTS
+        #define configTIMED_BUDGET_IN_RUN_TIME_COUNTS 0
+    #endif
+
+    #if configTIMED_BUDGET_IN_RUN_TIME_COUNTS == 1
+
+        #if configGENERATE_RUN_TIME_STATS != 1
+            #error If configTIMED_BUDGET_IN_RUN_TIME_COUNTS is set to 1 configGENERATE_RUN_TIME_STATS must be set to 1.
+        #endif
+
+        #ifndef portGET_RUN_TIME_COUNTER_VALUE
+            #error If configTIMED_BUDGET_IN_RUN_TIME_COUNTS is set to 1 portGET_RUN_TIME_COUNTER_VALUE must be defined, as the counter is also read outside of the context switch.
+        #endif
+
+        #ifndef configRUN_TIME_COUNTER_HZ
+            #error If configTIMED_BUDGET_IN_RUN_TIME_COUNTS is set to 1 configRUN_TIME_COUNTER_HZ must be set to the frequency of the run time counter.
+        #endif
+
+        /* Arms a one-shot interrupt of the run time counter after the given
+        number of counts. The interrupt calls vTaskTimedBudgetExpiredFromISR().
+        If not defined, overrun is only detected when the task is switched
+        out. */
+        #ifndef configTIMED_BUDGET_ARM
+            #define configTIMED_BUDGET_ARM( ulCounts )
+        #endif
+
+        /* Cancels the interrupt armed with configTIMED_BUDGET_ARM(). */
+        #ifndef configTIMED_BUDGET_DISARM
+            #define configTIMED_BUDGET_DISARM()
+        #endif
+
+    #endif
+
+    /* Set to 1 to keep statistics of the execution time of every job of a
+    timed task, see xTaskGetTimedStats(). */
+    #ifndef configUSE_TIMED_TASK_STATS
+        #define configUSE_TIMED_TASK_STATS 0
+    #endif
+
+    #if configUSE_TIMED_TASK_STATS == 1
+
+        #if configGENERATE_RUN_TIME_STATS != 1
+            #error If configUSE_TIMED_TASK_STATS is set to 1 configGENERATE_RUN_TIME_STATS must be set to 1, as execution time is measured in run time counts.
+        #endif
+
+        #ifndef portGET_RUN_TIME_COUNTER_VALUE
+            #error If configUSE_TIMED_TASK_STATS is set to 1 portGET_RUN_TIME_COUNTER_VALUE must be defined.
+        #endif
+
+        #ifndef configTIMED_TASK_STATS_BUCKETS
+            #define configTIMED_TASK_STATS_BUCKETS 16
+        #endif
+
+        #if configTIMED_TASK_STATS_BUCKETS < 2
+            #error configTIMED_TASK_STATS_BUCKETS must be set to a minimum of 2 in FreeRTOSConfig.h
+        #endif
+
+    #endif
+
+    /* Priority of timed tasks throttled by eTimedEnforceDemote or
+    eTimedEnforceSporadic, see xTaskTimedSetEnforcement(). */
+    #ifndef configTIMED_THROTTLE_PRIORITY
+        #define configTIMED_THROTTLE_PRIORITY 0
+    #endif
+
+    #if configTIMED_THROTTLE_PRIORITY >= configMAX_PRIORITIES
+        #error configTIMED_THROTTLE_PRIORITY must be below configMAX_PRIORITIES.
+    #endif
+
+    /* Set to 1 to schedule the tasks of configTIMED_EDF_PRIORITY in order of
+    the deadline given by their overflow time, see vTaskTimedReset(). */
+    #ifndef configUSE_TIMED_EDF
+        #define configUSE_TIMED_EDF 0
+    #endif
+
+    #if configUSE_TIMED_EDF == 1
+
+        #ifndef configTIMED_EDF_PRIORITY
+            #error If configUSE_TIMED_EDF is set to 1 configTIMED_EDF_PRIORITY must be set to the priority scheduled by deadline.
+        #endif
+
+        #if ( configTIMED_EDF_PRIORITY < 1 ) || ( configTIMED_EDF_PRIORITY >= configMAX_PRIORITIES )
+            #error configTIMED_EDF_PRIORITY must be above the idle priority and below configMAX_PRIORITIES.
+        #endif
+
+    #endif
+
+    /* Set to 1 to let a supervisor task receive overrun and overflow events
+    directly from the tick and the context switch, see
+    vTaskTimedSetSupervisor(). */
+    #ifndef configUSE_TIMED_SUPERVISOR
+        #define configUSE_TIMED_SUPERVISOR 0
+    #endif
+
+    #if configUSE_TIMED_SUPERVISOR == 1
+
+        /* Number of events that wait for the supervisor. Events that don't
+        fit are forwarded to the timer service task instead. */
+        #ifndef configTIMED_EVENT_QUEUE_LENGTH
+            #define configTIMED_EVENT_QUEUE_LENGTH 8
+        #endif
+
+        #if configTIMED_EVENT_QUEUE_LENGTH < 1
+            #error configTIMED_EVENT_QUEUE_LENGTH must be set to a minimum of 1 in FreeRTOSConfig.h
+        #endif
+
+    #endif
+
+    /* Set to 1 to give timed tasks a criticality level, see
+    xTaskTimedSetCriticality(). */
+    #ifndef configUSE_TIMED_CRITICALITY
+        #define configUSE_TIMED_CRITICALITY 0
+    #endif
+
+    #if configUSE_TIMED_CRITICALITY == 1
+
+        /* Priority of LO criticality tasks while the kernel is in HI mode. At
+        the idle priority they only run when the kernel returns to LO mode. */
+        #ifndef configTIMED_HI_MODE_LO_PRIORITY
+            #define configTIMED_HI_MODE_LO_PRIORITY 0
+        #endif
+
+        #if configTIMED_HI_MODE_LO_PRIORITY >= configMAX_PRIORITIES
+            #error configTIMED_HI_MODE_LO_PRIORITY must be below configMAX_PRIORITIES.
+        #endif
+
+    #endif
+
+    /* Set to 1 to count the jobs of timed tasks that use more than
+    configTIMED_BUDGET_WARNING_PERCENT of their overrun time, see
+    ulTaskTimedGetBudgetWarnings(). */
+    #ifndef configUSE_TIMED_BUDGET_WARNING
+        #define configUSE_TIMED_BUDGET_WARNING 0
+    #endif
+
+    #if configUSE_TIMED_BUDGET_WARNING == 1
+
+        #ifndef configTIMED_BUDGET_WARNING_PERCENT
+            #define configTIMED_BUDGET_WARNING_PERCENT 80
+        #endif
+
+        #if ( configTIMED_BUDGET_WARNING_PERCENT < 1 ) || ( configTIMED_BUDGET_WARNING_PERCENT > 99 )
+            #error configTIMED_BUDGET_WARNING_PERCENT must be between 1 and 99.
+        #endif
+
+    #endif
+
+    /* Called when a timed task passes the warning threshold of its budget. */
+    #ifndef traceTIMED_BUDGET_WARNING
+        #define traceTIMED_BUDGET_WARNING( pxTCB )
     #endif
 
 #endif
@@ -255,6 +405,34 @@ extern "C" {
         #error If INCLUDE_xTaskCreateReplicated is defined configSUPPORT_DYNAMIC_ALLOCATION must be set to 1.
     #endif
 
+    #if INCLUDE_vTaskSuspend != 1
+        #error If INCLUDE_xTaskCreateReplicated is defined INCLUDE_vTaskSuspend must be set to 1 so replicas can wait on the synchronization point indefinitely.
+    #endif
+
+    #if INCLUDE_vTaskDelete != 1
+        #error If INCLUDE_xTaskCreateReplicated is defined INCLUDE_vTaskDelete must be set to 1.
+    #endif
+
+    #ifndef configMAX_REPLICATED_TASKS
+        #define configMAX_REPLICATED_TASKS 3
+    #endif
+
+    #if configMAX_REPLICATED_TASKS < 2
+        #error configMAX_REPLICATED_TASKS must be set to a minimum of 2 in FreeRTOSConfig.h
+    #endif
+
+    #if configMAX_REPLICATED_TASKS > 32
+        #error configMAX_REPLICATED_TASKS must be set to a maximum of 32 in FreeRTOSConfig.h as arrival of replicas is tracked in a 32 bit mask
+    #endif
+
+    #ifndef configMAX_REPLICATED_CHECKPOINTS
+        #define configMAX_REPLICATED_CHECKPOINTS 4
+    #endif
+
+    #if configMAX_REPLICATED_CHECKPOINTS < 1
+        #error configMAX_REPLICATED_CHECKPOINTS must be set to a minimum of 1 in FreeRTOSConfig.h
+    #endif
+
 #endif
 
 /* The timers module relies on xTaskGetSchedulerState(). */
@@ -826,6 +1004,73 @@ extern "C" {
 	#define configUSE_TASK_NOTIFICATIONS 1
 #endif
 
+#ifndef configUSE_TIMER_COMMAND_RING
+	#define configUSE_TIMER_COMMAND_RING 0
+#endif
+
+#if( ( configUSE_TIMER_COMMAND_RING == 1 ) && ( configUSE_TASK_NOTIFICATIONS != 1 ) )
+	#error configUSE_TIMER_COMMAND_RING requires configUSE_TASK_NOTIFICATIONS to be set to 1, the timer service task blocks on its notification.
+#endif
+
+#if( ( INCLUDE_xTaskCreateTimed == 1 ) && ( configUSE_TIMED_SUPERVISOR == 1 ) && ( configUSE_TASK_NOTIFICATIONS != 1 ) )
+	#error configUSE_TIMED_SUPERVISOR requires configUSE_TASK_NOTIFICATIONS to be set to 1, the supervisor is woken by a notification.
+#endif
+
+#if( ( configUSE_TIMER_COMMAND_RING == 1 ) && ( INCLUDE_vTaskDelay != 1 ) )
+	#error configUSE_TIMER_COMMAND_RING requires INCLUDE_vTaskDelay to be set to 1, senders poll a full ring once a tick.
+#endif
+
+#ifndef configUSE_TIMER_COMMAND_COALESCING
+	#define configUSE_TIMER_COMMAND_COALESCING 0
+#endif
+
+#if( ( configUSE_TIMER_COMMAND_COALESCING == 1 ) && ( configUSE_TIMER_COMMAND_RING != 1 ) )
+	#error configUSE_TIMER_COMMAND_COALESCING requires configUSE_TIMER_COMMAND_RING to be set to 1, pending commands cannot be changed in a queue.
+#endif
+
+#ifndef configUSE_TIMER_SLACK
+	#define configUSE_TIMER_SLACK 0
+#endif
+
+#ifndef configTIMER_SERVICE_LANES
+	#define configTIMER_SERVICE_LANES 1
+#endif
+
+#if( configTIMER_SERVICE_LANES < 1 )
+	#error configTIMER_SERVICE_LANES must be at least 1 in FreeRTOSConfig.h
+#endif
+
+#ifndef configTIMER_LANE_PRIORITIES
+	#if( configTIMER_SERVICE_LANES > 1 )
+		#error If configTIMER_SERVICE_LANES is more than 1 then configTIMER_LANE_PRIORITIES must list the priority of every lane.
+	#endif
+	#define configTIMER_LANE_PRIORITIES { configTIMER_TASK_PRIORITY }
+#endif
+
+#ifndef configTIMER_KERNEL_LANE
+	#define configTIMER_KERNEL_LANE ( configTIMER_SERVICE_LANES - 1 )
+#endif
+
+#if( configTIMER_KERNEL_LANE >= configTIMER_SERVICE_LANES )
+	#error configTIMER_KERNEL_LANE must be less than configTIMER_SERVICE_LANES in FreeRTOSConfig.h
+#endif
+
+#ifndef configUSE_TIMER_WHEEL
+	#define configUSE_TIMER_WHEEL 0
+#endif
+
+#ifndef configTIMER_WHEEL_SLOT_BITS
+	#define configTIMER_WHEEL_SLOT_BITS 4
+#endif
+
+#if( ( configUSE_TIMER_WHEEL == 1 ) && ( ( configTIMER_WHEEL_SLOT_BITS < 1 ) || ( configTIMER_WHEEL_SLOT_BITS > 8 ) ) )
+	#error configTIMER_WHEEL_SLOT_BITS must be set between 1 and 8 in FreeRTOSConfig.h
+#endif
+
+#ifndef portMEMORY_BARRIER
+	#define portMEMORY_BARRIER()
+#endif
+
 #ifndef portTICK_TYPE_IS_ATOMIC
 	#define portTICK_TYPE_IS_ATOMIC 0
 #endif
@@ -1039,7 +1284,7 @@ typedef struct xSTATIC_TCB
 		uint32_t 		ulDummy18;
 		uint8_t 		ucDummy19;
 	#endif
-	#if( ( ( configSUPPORT_STATIC_ALLOCATION == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) ) || ( portUSING_MPU_WRAPPERS == 1 ) )
+	#if( ( ( configSUPPORT_STATIC_ALLOCATION == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) ) || ( portUSING_MPU_WRAPPERS == 1 ) || ( INCLUDE_xTaskCreateReplicated == 1 ) )
 		uint8_t			uxDummy20;
 	#endif
 
@@ -1054,17 +1299,84 @@ typedef struct xSTATIC_TCB
     void        *xDummy24;
     uint32_t     xDummy25;
     uint32_t     xDummy26;
+    StaticListItem_t xDummy33;
+    uint32_t     xDummy34[ 2 ];
+    StaticListItem_t xDummy38;
+    uint32_t     xDummy39;
+    UBaseType_t  uxDummy40;
+    uint32_t     xDummy42[ 2 ];
+    uint8_t      ucDummy41[ 3 ];
+        #if ( configUSE_TIMED_BUDGET_WARNING == 1 )
+        uint32_t     xDummy49[ 2 ];
+        uint8_t      ucDummy50;
+        #endif
+        #if ( configUSE_TIMED_CRITICALITY == 1 )
+        StaticListItem_t xDummy45;
+        uint32_t     xDummy46[ 2 ];
+        UBaseType_t  uxDummy47;
+        uint8_t      ucDummy48[ 2 ];
+        #endif
+        #if ( configUSE_TIMED_TASK_STATS == 1 )
+        uint32_t     ulDummy35[ 6 ];
+        uint64_t     ullDummy36;
+        uint32_t     ulDummy37[ configTIMED_TASK_STATS_BUCKETS ];
+        uint32_t     ulDummy43[ 6 ];
+        uint64_t     ullDummy44[ 2 ];
+        #endif
     #endif
 
     #if ( INCLUDE_xTaskCreateReplicated == 1 )
-	    uint8_t     ucDummy27;
-	    void        *pxDummy28;
-	    uint32_t    xDummy29;
-	    void        *xDummy30;
-	    uint8_t     ucDummy31;
+	    void        *pxDummy27;
+	    uint32_t    xDummy28;
+	    void        *pxDummy29;
+	    uint8_t     ucDummy30;
+	    uint32_t    xDummy31[ configMAX_REPLICATED_CHECKPOINTS ];
+	    UBaseType_t uxDummy32;
 	#endif
 } StaticTask_t;
 
+#if ( INCLUDE_xTaskCreateReplicated == 1 )
+/*
+ * Same as StaticTask_t, but for the descriptor shared by the replicas of a
+ * group created with xTaskCreateReplicatedStatic().
+ */
+typedef struct xSTATIC_REPLICATED_GROUP
+{
+    StaticList_t    xDummy1;
+    void            *pvDummy2[ configMAX_REPLICATED_TASKS ];
+    uint32_t        ulDummy3[ 2 ];
+    uint8_t         ucDummy4[ 2 ];
+    void            *pvDummy5;
+    BaseType_t      xDummy6;
+    struct
+    {
+        uint32_t    ulDummy7[ 2 ];
+        uint8_t     ucDummy8;
+        uint32_t    ulDummy9;
+        UBaseType_t uxDummy10;
+    } xDummy11;
+    BaseType_t      xDummy12;
+    uint32_t        ulDummy13[ 4 ];
+    uint8_t         ucDummy14;
+    uint32_t        ulDummy15[ configMAX_REPLICATED_CHECKPOINTS ];
+    UBaseType_t     uxDummy16;
+    uint32_t        ulDummy17;
+    UBaseType_t     uxDummy18;
+    void            *pvDummy19;
+    uint32_t        ulDummy20[ configMAX_REPLICATED_TASKS ];
+    BaseType_t      xDummy21;
+    void            *pvDummy22;
+    configSTACK_DEPTH_TYPE xDummy23;
+    void            *pvDummy24;
+    UBaseType_t     uxDummy25;
+    void            *pvDummy26;
+    size_t          xDummy27;
+    uint8_t         ucDummy28;
+    UBaseType_t     uxDummy29;
+    BaseType_t      xDummy30;
+} StaticReplicatedGroup_t;
+#endif
+
 /*
  * In line with software engineering best practice, especially when supplying a
  * library that is likely to change in future versions, FreeRTOS implements a
@@ -1159,6 +1471,12 @@ typedef struct xSTATIC_TIMER
 	TickType_t			xDummy3;
 	UBaseType_t			uxDummy4;
 	TickType_t          xDummy5;
+	#if( configUSE_TIMER_SLACK == 1 )
+		TickType_t		xDummy9;
+	#endif
+	#if( configTIMER_SERVICE_LANES > 1 )
+		UBaseType_t		uxDummy10;
+	#endif
 	void 				*pvDummy6[ 2 ];
 	#if( configUSE_TRACE_FACILITY == 1 )
 		UBaseType_t		uxDummy7;
@@ -0,0 +1,64 @@
+/*
+ * Incremental digest used to compare wide outputs of replicated tasks.
+ *
+ * The digest is CRC-32/MPEG-2 (polynomial 0x04C11DB7, initial value
+ * 0xFFFFFFFF, no reflection, no final XOR) over the bytes in memory order.
+ * The same polynomial is used by the CRC peripheral of STM32 devices.
+ *
+ * Data can be fed in any number of pieces, the result only depends on the
+ * concatenated byte stream.
+ *
+ * Backend is selected at build time. If configCOMPARE_DIGEST_UPDATE is defined
+ * in FreeRTOSConfig.h, ulCompareDigestUpdate() calls it, otherwise the software
+ * implementation is used. configCOMPARE_DIGEST_UPDATE has the same prototype as
+ * ulCompareDigestUpdate(), shall be called from task context only and shall
+ * return results identical to ulCompareDigestUpdateSoftware().
+ */
+
+#ifndef COMPARE_DIGEST_H
+#define COMPARE_DIGEST_H
+
+#ifndef INC_FREERTOS_H
+	#error "include FreeRTOS.h must appear in source files before include compare_digest.h"
+#endif
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Value of the digest before any data is fed into it. */
+#define digestINITIAL_VALUE ( ( uint32_t ) 0xFFFFFFFFUL )
+
+/**
+ * compare_digest. h
+ * <pre>uint32_t ulCompareDigestUpdate( uint32_t ulDigest, const void * pvData, size_t xLength );</pre>
+ *
+ * Feeds xLength bytes into the digest using the backend selected at build time.
+ *
+ * @param ulDigest Current digest. digestINITIAL_VALUE to start a new digest.
+ *
+ * @param pvData Data to feed into the digest. Any alignment is accepted.
+ *
+ * @param xLength Number of bytes in pvData.
+ *
+ * @return Updated digest.
+ */
+uint32_t ulCompareDigestUpdate( uint32_t ulDigest, const void * pvData, size_t xLength );
+
+/**
+ * compare_digest. h
+ * <pre>uint32_t ulCompareDigestUpdateSoftware( uint32_t ulDigest, const void * pvData, size_t xLength );</pre>
+ *
+ * Software implementation of ulCompareDigestUpdate(). Always available, so
+ * hardware backends can use it for data that can't be offloaded.
+ */
+uint32_t ulCompareDigestUpdateSoftware( uint32_t ulDigest, const void * pvData, size_t xLength );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* COMPARE_DIGEST_H */
+
@@ -79,6 +79,92 @@ typedef BaseType_t (*TaskHookFunction_t)( void * );
      */
     typedef void (*WorstTimeTimerCb_t)( WorstTimeTimerHandle_t xTimer );
 
+    /*
+     * Converts a time in microseconds to the units of xOverrunTime, which are
+     * ticks or run time counts, depending on configTIMED_BUDGET_IN_RUN_TIME_COUNTS.
+     */
+    #if( configTIMED_BUDGET_IN_RUN_TIME_COUNTS == 1 )
+        #define taskUS_TO_OVERRUN_TIME( xTimeInUs ) ( ( TickType_t ) ( ( ( uint64_t ) ( xTimeInUs ) * ( uint64_t ) configRUN_TIME_COUNTER_HZ ) / ( uint64_t ) 1000000U ) )
+    #else
+        #define taskUS_TO_OVERRUN_TIME( xTimeInUs ) ( ( TickType_t ) ( ( ( uint64_t ) ( xTimeInUs ) * ( uint64_t ) configTICK_RATE_HZ ) / ( uint64_t ) 1000000U ) )
+    #endif
+
+    #if( configUSE_TIMED_TASK_STATS == 1 )
+        /*
+         * Execution time statistics of the jobs of a timed task. A job is the
+         * run time of the task between two calls to vTaskTimedReset(). Times
+         * are in run time counts.
+         */
+        typedef struct xTIMED_STATS
+        {
+            uint32_t ulJobs; /*< Number of jobs since the statistics were cleared. */
+            uint32_t ulMin;  /*< Shortest job since the statistics were cleared. */
+            uint32_t ulMax;  /*< Longest job since the statistics were cleared. */
+            uint32_t ulMean; /*< Mean job since the statistics were cleared. */
+            uint32_t ulWcet; /*< Longest job since the task was created. Not cleared. */
+            uint32_t ulDeadlineMisses; /*< Jobs of a periodic task that ended after their deadline. */
+            uint32_t ulJitterMax;      /*< Largest delay of a release of a periodic task after its due tick, in ticks. */
+            uint32_t ulLatencyMax;     /*< Largest time from the release of a job of a periodic task until it first ran. */
+            uint32_t ulLatencyMean;
+            uint32_t ulResponseMax;    /*< Largest time from the release of a job of a periodic task until it ended. */
+            uint32_t ulResponseMean;
+            uint32_t ulBuckets[ configTIMED_TASK_STATS_BUCKETS ]; /*< Bucket 0 counts jobs of 0, bucket n jobs from 2^(n-1) to 2^n - 1. Last bucket also counts all longer jobs. */
+            #if( configUSE_TIMED_BUDGET_WARNING == 1 )
+                uint32_t ulBudgetWarnings; /*< Times the task passed the warning threshold of its overrun time, see ulTaskTimedGetBudgetWarnings(). */
+            #endif
+        } TimedStats_t;
+    #endif
+
+    /*
+     * What the kernel does when the overrun time of a timed task runs out,
+     * see xTaskTimedSetEnforcement(). The overrun callback is called in all
+     * cases.
+     */
+    typedef enum
+    {
+        eTimedEnforceNone = 0, /* Only the callback is called and the overrun time restarts. */
+        eTimedEnforceDemote,   /* Task runs at configTIMED_THROTTLE_PRIORITY until the next replenishment period. */
+        eTimedEnforceSuspend,  /* Task is delayed until the next replenishment period. */
+        eTimedEnforceSporadic  /* Task runs at configTIMED_THROTTLE_PRIORITY until its budget is replenished, one period after it started using it. */
+    } eTimedEnforcement;
+
+    #if( configUSE_TIMED_CRITICALITY == 1 )
+        /*
+         * Criticality level of a timed task and mode of the kernel, see
+         * xTaskTimedSetCriticality().
+         */
+        typedef enum
+        {
+            eTimedCriticalityLo = 0, /* Task is held back in HI mode. Kernel runs all tasks on their normal budgets. */
+            eTimedCriticalityHi      /* Task gets its larger budget in HI mode. Kernel protects the HI tasks. */
+        } eTimedCriticality;
+    #endif
+
+    #if( configUSE_TIMED_SUPERVISOR == 1 )
+        /*
+         * Kind of an event received by the supervisor, see
+         * xTaskTimedReceiveEvent().
+         */
+        typedef enum
+        {
+            eTimedEventOverrun = 0, /* Overrun time of the task ran out. */
+            eTimedEventOverflow,    /* Overflow time of the task ran out. */
+            eTimedEventWarning      /* Task used configTIMED_BUDGET_WARNING_PERCENT of its overrun time. */
+        } eTimedEvent;
+
+        /*
+         * Event posted to the supervisor by the tick or the context switch.
+         */
+        typedef struct xTIMED_EVENT
+        {
+            TaskHandle_t xTask;             /*< Timed task the event is about. */
+            WorstTimeTimerHandle_t xTimer;  /*< Timer whose callback would have been called without the supervisor. Overrun timer for a warning. */
+            eTimedEvent eEvent;
+            TickType_t xTickCount;          /*< Tick the event was detected on. */
+            uint32_t ulRunTimeCounter;      /*< Run time counter when the event was detected, 0 if run time stats are not generated. */
+        } TimedEvent_t;
+    #endif
+
 #endif
 
 #if( INCLUDE_xTaskCreateReplicated == 1 )
@@ -95,17 +181,41 @@ typedef BaseType_t (*TaskHookFunction_t)( void * );
      * @param ucLen            Number of elements in ppvCompareValue
      *
      * @retval pdTRUE is returned to delete all replicated tasks, pdFALSE is
-     *         returned to unblock all replicated tasks
+     *         returned to unblock all replicated tasks, taskREPLICATED_RESPAWN
+     *         is returned to replace diverged replicas with new tasks
      */
     typedef uint8_t (*RedundantValueErrorCb_t)( CompareValue_t * pxCompareValues, uint8_t ucLen );
 
+    /*
+     * Segment of data fed into the compare digest with
+     * vTaskCompareDigestUpdateScatter()
+     */
+    typedef struct xCOMPARE_DIGEST_SEGMENT
+    {
+        const void * pvData; /*< Start of the segment. */
+        size_t xLength;      /*< Length of the segment in bytes. */
+    } CompareDigestSegment_t;
+
+    /*
+     * Result of the last comparison of a replicated group. It is filled
+     * before RedundantValueErrorCb_t is called.
+     */
+    typedef struct xREPLICATED_MISMATCH
+    {
+        uint32_t ulDivergedMask;    /*< Bit n is set if replica n differs from the voted value. */
+        CompareValue_t xVotedValue; /*< Most common compare value. */
+        uint8_t ucVotes;            /*< Number of replicas with the voted value. */
+        uint32_t ulSyncIndex;       /*< Synchronization point of the comparison, counted from 0. */
+        UBaseType_t uxCheckpoint;   /*< First diverged checkpoint of the synchronization point, see xTaskRecordCompareValue(). */
+    } ReplicatedMismatch_t;
+
 #endif
 
 typedef enum
 {
   eDefault = 0, /* Normal task previously available in freeRTOS. */
   eTimed,       /* Timed task has a timer that tracks the execution time. */
-  eReplicated   /* Replicated task is replicated 2 or 3 times to introduce redundancy. */
+  eReplicated   /* Replicated task is replicated 2 to configMAX_REPLICATED_TASKS times to introduce redundancy. */
 } eTaskType;
 
 /* Task states returned by eTaskGetState. */
@@ -129,10 +239,21 @@ typedef enum
 	eSetValueWithoutOverwrite	/* Set the task's notification value if the previous value has been read by the task. */
 } eNotifyAction;
 
-/* Macro for replicated task type */
+/* Macro for replicated task type. Any number of replicas between
+ * taskREPLICATED_NO_RECOVERY and configMAX_REPLICATED_TASKS can be used. */
 #define taskREPLICATED_NO_RECOVERY ( ( uint8_t ) 2 )
 #define taskREPLICATED_RECOVERY    ( ( uint8_t ) 3 ) /*< Recovery is achieved by having three tasks,
                                                          using 2 out of 3 logic for recovery on error */
+
+/* Flag ORed into the replicated task type, valid for groups of three or more
+ * replicas. A majority of replicas that arrive on the synchronization point
+ * with the same value is released without waiting for the rest. The rest is
+ * compared when it arrives, a late mismatch calls RedundantValueErrorCb_t. */
+#define taskREPLICATED_EARLY_RELEASE ( ( uint8_t ) 0x80 )
+
+/* Return value of RedundantValueErrorCb_t. Diverged replicas are deleted and
+ * created again, their state block is copied from a majority replica. */
+#define taskREPLICATED_RESPAWN     ( ( uint8_t ) 2 )
 /*
  * Used internally only.
  */
@@ -401,13 +522,25 @@ BaseType_t xTaskCreateTimed( TaskFunction_t pxTaskCode,
  * its punctuality is dependent on timer daemon's priority. If overflow timer
  * is not used send 0 for xOverflowTime or NULL for the callback.
  *
+ * Both counters are kept by the kernel without the timer daemon, so context
+ * switches and vTaskTimedReset() don't send commands to the timer daemon. Only
+ * an overrun or overflow that happened is forwarded to the daemon.
+ *
+ * If configUSE_TIMED_EDF is 1, tasks of configTIMED_EDF_PRIORITY are scheduled
+ * earliest deadline first instead of round robin. The deadline of a timed task
+ * is the tick its overflow time runs out. Tasks of that priority without an
+ * overflow time run only when no task with a deadline is ready. A task with an
+ * earlier deadline that becomes ready preempts the running task of the same
+ * priority at the latest on the next tick.
+ *
  * Internally, within the FreeRTOS implementation, tasks use two blocks of
  * memory.  The first block is used to hold the task's data structures.  The
  * second block is used by the task as its stack.  If a task is created using
  * xTaskCreateTimed() then both blocks of memory are automatically dynamically
  * allocated inside the xTaskCreate() function.  (see
- * http://www.freertos.org/a00111.html). Static version of the function is not
- * implemented.
+ * http://www.freertos.org/a00111.html). If a task is created using
+ * xTaskCreateTimedStatic() then the application writer must provide the
+ * memory for the task and its timers.
  *
  * @param pvTaskCode Pointer to the task entry function.  Tasks
  * must be implemented to never return (i.e. continuous loop).
@@ -434,6 +567,8 @@ BaseType_t xTaskCreateTimed( TaskFunction_t pxTaskCode,
  * can be referenced.
  *
  * @param xOverrunTime Runtime of the task after which callback will be called.
+ * In ticks, or in run time counts if configTIMED_BUDGET_IN_RUN_TIME_COUNTS is
+ * set to 1. Use taskUS_TO_OVERRUN_TIME() to get the same time in both.
  *
  * @param pxOverrunTimerCb Pointer to the function that will be called if task
  * runs longer than xOverrunTime without reseting the timed task. Overrun timer
@@ -518,7 +653,7 @@ void vTaskOverrunCallback ( WorstTimeTimerHandle_t xTimer )
  * \defgroup xTaskCreateTimed xTaskCreateTimed
  * \ingroup Tasks
  */
-#if( INCLUDE_xTaskCreateTimed == 1 )
+#if( ( INCLUDE_xTaskCreateTimed == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
     BaseType_t xTaskCreateTimed( TaskFunction_t pxTaskCode,
                         const char * const pcName,
                         const configSTACK_DEPTH_TYPE usStackDepth,
@@ -531,6 +666,141 @@ void vTaskOverrunCallback ( WorstTimeTimerHandle_t xTimer )
                         WorstTimeTimerCb_t pxOverflowTimerCb );
 #endif
 
+/**
+ * task. h
+ *<pre>
+ TaskHandle_t xTaskCreateTimedStatic( TaskFunction_t pxTaskCode,
+                                      const char * const pcName,
+                                      const uint32_t ulStackDepth,
+                                      void * const pvParameters,
+                                      UBaseType_t uxPriority,
+                                      StackType_t * const puxStackBuffer,
+                                      StaticTask_t * const pxTaskBuffer,
+                                      TickType_t xOverrunTime,
+                                      WorstTimeTimerCb_t pxOverrunTimerCb,
+                                      StaticTimer_t * const pxOverrunTimerBuffer,
+                                      TickType_t xOverflowTime,
+                                      WorstTimeTimerCb_t pxOverflowTimerCb,
+                                      StaticTimer_t * const pxOverflowTimerBuffer );</pre>
+ *
+ * Create a new timed task without allocating memory, see xTaskCreateStatic()
+ * and xTaskCreateTimed(). Memory of the TCB, the stack and both timers is
+ * provided by the application writer, so creation doesn't depend on the heap.
+ *
+ * @param puxStackBuffer Must point to a StackType_t array that has at least
+ * ulStackDepth indexes.
+ *
+ * @param pxTaskBuffer Must point to a variable of type StaticTask_t, which
+ * will then be used to hold the task's data structures.
+ *
+ * @param pxOverrunTimerBuffer Must point to a variable of type StaticTimer_t
+ * if pxOverrunTimerCb is not NULL. Can be NULL otherwise.
+ *
+ * @param pxOverflowTimerBuffer Must point to a variable of type StaticTimer_t
+ * if pxOverflowTimerCb is not NULL. Can be NULL otherwise.
+ *
+ * Rest of the parameters are the same as in xTaskCreateTimed().
+ *
+ * @return If neither puxStackBuffer or pxTaskBuffer are NULL, then the task
+ * will be created and a handle to the created task is returned.  If either
+ * puxStackBuffer or pxTaskBuffer are NULL then the task will not be created
+ * and NULL is returned.
+ *
+ * \defgroup xTaskCreateTimedStatic xTaskCreateTimedStatic
+ * \ingroup Tasks
+ */
+#if( ( INCLUDE_xTaskCreateTimed == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) )
+    TaskHandle_t xTaskCreateTimedStatic( TaskFunction_t pxTaskCode,
+                        const char * const pcName,
+                        const uint32_t ulStackDepth,
+                        void * const pvParameters,
+                        UBaseType_t uxPriority,
+                        StackType_t * const puxStackBuffer,
+                        StaticTask_t * const pxTaskBuffer,
+                        TickType_t xOverrunTime,
+                        WorstTimeTimerCb_t pxOverrunTimerCb,
+                        StaticTimer_t * const pxOverrunTimerBuffer,
+                        TickType_t xOverflowTime,
+                        WorstTimeTimerCb_t pxOverflowTimerCb,
+                        StaticTimer_t * const pxOverflowTimerBuffer );
+#endif
+
+/**
+* task. h
+*<pre>
+BaseType_t xTaskCreateTimedPeriodic( TaskFunction_t pxTaskCode,
+                    const char * const pcName,
+                    const configSTACK_DEPTH_TYPE usStackDepth,
+                    void * const pvParameters,
+                    UBaseType_t uxPriority,
+                    TaskHandle_t * const pxCreatedTask,
+                    TickType_t xPeriod,
+                    TickType_t xOverrunTime,
+                    WorstTimeTimerCb_t pxOverrunTimerCb,
+                    TickType_t xDeadline,
+                    WorstTimeTimerCb_t pxDeadlineMissCb );</pre>
+*
+* Create a timed task whose jobs are released by the kernel every xPeriod
+* ticks. The first job is released when the task is created. A job ends when
+* the task calls vTaskTimedWaitForNextPeriod(), which blocks the task until the
+* next release, so the task doesn't call vTaskDelayUntil() and
+* vTaskTimedReset() itself.
+*
+* The overflow time is the relative deadline of a job, counted from the tick
+* the job was due. pxDeadlineMissCb is called from the timer daemon when a job
+* is still running at its deadline. The overrun time restarts on every job.
+*
+* If configUSE_TIMED_TASK_STATS is 1, xTaskGetTimedStats() also returns the
+* release jitter, the start latency and the response time of the jobs, and the
+* number of jobs that ended after their deadline.
+*
+* @param xPeriod Release period in ticks.
+*
+* @param xDeadline Relative deadline in ticks, at most xPeriod. Deadline is
+* xPeriod if 0 or pxDeadlineMissCb is NULL, but no callback is called then.
+*
+* Rest of the parameters are the same as in xTaskCreateTimed().
+*
+* @return pdPASS if the task was successfully created and added to a ready
+* list, otherwise an error code defined in the file projdefs.h
+*
+* Example usage:
+<pre>
+void vPeriodicTask( void * pvParameters )
+{
+    for( ;; )
+    {
+        // Job code goes here.
+
+        vTaskTimedWaitForNextPeriod();
+    }
+}
+
+void vOtherFunction( void )
+{
+    // 10 ms period, 8 ms deadline.
+    xTaskCreateTimedPeriodic( vPeriodicTask, "PERIODIC", STACK_SIZE, NULL,
+                              tskIDLE_PRIORITY, NULL, pdMS_TO_TICKS( 10 ),
+                              0, NULL, pdMS_TO_TICKS( 8 ), vDeadlineMissCb );
+}
+</pre>
+* \defgroup xTaskCreateTimedPeriodic xTaskCreateTimedPeriodic
+* \ingroup Tasks
+*/
+#if( ( INCLUDE_xTaskCreateTimed == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+    BaseType_t xTaskCreateTimedPeriodic( TaskFunction_t pxTaskCode,
+                        const char * const pcName,
+                        const configSTACK_DEPTH_TYPE usStackDepth,
+                        void * const pvParameters,
+                        UBaseType_t uxPriority,
+                        TaskHandle_t * const pxCreatedTask,
+                        TickType_t xPeriod,
+                        TickType_t xOverrunTime,
+                        WorstTimeTimerCb_t pxOverrunTimerCb,
+                        TickType_t xDeadline,
+                        WorstTimeTimerCb_t pxDeadlineMissCb );
+#endif
+
 /**
 * task. h
 *<pre>
@@ -546,20 +816,29 @@ BaseType_t xTaskCreateReplicated( TaskFunction_t pxTaskCode,
 * Create a new replicated task and add it to the list of tasks that are ready to
 * run. Replicated task is used to achieve redundancy of the software at the
 * expense of slower execution. Task executes slower because it is replicated
-* two or three times. Depending  on the type chosen. On every call to
-* vTaskSyncAndCompare task is suspended until every replicated task arrives to
+* ucReplicatedType times. On every call to
+* vTaskSyncAndCompare task is blocked until every replicated task arrives to
 * the same point. When every task is in the synchronization function comparison
 * is done. If any of the comparison results differ callback function
 * pxRedundantValueErrorCb is called. In the callback function user can access
-* the compare values and choose whether to delete all the tasks.
+* the compare values and choose whether to delete all the tasks. Compare values
+* can be voted on with ucTaskVoteCompareValues().
+*
+* All replicas share one group descriptor. Arrival on the synchronization
+* point is tracked with a bitmask, so the check costs the same regardless of
+* the number of replicas.
 *
 * Internally, within the FreeRTOS implementation, tasks use two blocks of
 * memory.  The first block is used to hold the task's data structures.  The
 * second block is used by the task as its stack.  If a task is created using
 * xTaskCreateReplicated() then both blocks of memory are automatically
 * dynamically allocated inside the xTaskCreateReplicated() function.  (see
-* http://www.freertos.org/a00111.html). Static version of this function is not
-* implemented.
+* http://www.freertos.org/a00111.html). Blocks of all replicas and the group
+* descriptor are allocated with a single pvPortMalloc() call and freed together
+* when the group is deleted. A replica respawned by taskREPLICATED_RESPAWN
+* reuses its TCB and stack in the block. If a task is created using
+* xTaskCreateReplicatedStatic() then the application writer must provide the
+* memory for every replica and the group.
 *
 * @param pvTaskCode Pointer to the task entry function.  Tasks
 * must be implemented to never return (i.e. continuous loop).
@@ -585,14 +864,27 @@ BaseType_t xTaskCreateReplicated( TaskFunction_t pxTaskCode,
 * @param pvCreatedTask Used to pass back a handle by which the created task
 * can be referenced.
 *
-* @param ucReplicatedType Valid values: taskREPLICATED_NO_RECOVERY and
-* taskREPLICATED_RECOVERY. No recovery is faster as it created only two
-* instances, but recovery is not possible. Recovery creates three identical
-* tasks. Recovery is possible with 2 out of 3 logic.
+* @param ucReplicatedType Number of replicas to create, from
+* taskREPLICATED_NO_RECOVERY (2) up to configMAX_REPLICATED_TASKS.
+* taskREPLICATED_NO_RECOVERY is faster as it creates only two instances, but
+* recovery is not possible. taskREPLICATED_RECOVERY (3) creates three identical
+* tasks. Recovery is possible with 2 out of 3 logic. Larger groups, e.g. 5,
+* tolerate more diverged replicas while a majority still exists.
+* 
+* taskREPLICATED_EARLY_RELEASE can be ORed into the number of replicas of groups
+* with three or more replicas. When a majority of replicas arrives on
+* vTaskSyncAndCompare with the same value, it is released without waiting for
+* the rest, so the latency of the sync point follows the faster replicas. Late
+* replicas are compared with the agreed value when they arrive and don't wait,
+* a late mismatch calls pxRedundantValueErrorCb from the late replica. Replicas
+* are at most one round apart, the next round is not released early until all
+* late replicas arrived. taskREPLICATED_RESPAWN returned for a late mismatch
+* is done on the next round every replica arrives on.
 *
 * @param pxRedundantValueErrorCb Function to be called when compare values do
 * not match. Return value determines whether calling redundant task will be
-* deleted.
+* deleted, or whether diverged replicas are respawned, see
+* pvTaskGetReplicatedState().
 *
 * @return pdPASS if the task was successfully created and added to a ready
 * list, otherwise an error code defined in the file projdefs.h
@@ -613,13 +905,13 @@ void vTaskCode( void * pvParameters )
 // NOTE: This function is called from the redundant task and not daemon.
 uint8_t ucCompareErrorCb (CompareValue_t * pxCompareValues, uint8_t ucLen)
 {
-    // Iterate through compare values.
-    for(uint8_t iii = 0; iii < ucLen; i++)
+    CompareValue_t xVotedValue;
+
+    // Count the votes of the most common compare value.
+    if( ucTaskVoteCompareValues( pxCompareValues, ucLen, &xVotedValue ) > ucLen / 2 )
     {
-        pxCompareValue[iii]
-        .
-        .
-        .
+        // Majority agrees on xVotedValue.
+        return pdFALSE;
     }
 
     return pdTRUE; // Signaling to delete the redundant task.
@@ -635,7 +927,7 @@ TaskHandle_t xHandle = NULL;
     // must exist for the lifetime of the task, so in this case is declared static.  If it was just an
     // an automatic stack variable it might no longer exist, or at least have been corrupted, by the time
     // the new task attempts to access it.
-    xTaskCreate( vTaskCode, "NAME", STACK_SIZE, &ucParameterToPass, tskIDLE_PRIORITY, &xHandle, taskREPLICATED_RECOVERY, ucCompareErrorCb );
+    xTaskCreateReplicated( vTaskCode, "NAME", STACK_SIZE, &ucParameterToPass, tskIDLE_PRIORITY, &xHandle, 5, ucCompareErrorCb );
     configASSERT( xHandle );
 
     // Use the handle to delete the task.
@@ -659,6 +951,116 @@ TaskHandle_t xHandle = NULL;
                             RedundantValueErrorCb_t pxRedundantValueErrorCb );
 #endif
 
+/**
+* task. h
+*<pre>
+BaseType_t xTaskCreateReplicatedStatic( TaskFunction_t pxTaskCode,
+                        const char * const pcName,
+                        const uint32_t ulStackDepth,
+                        void * const pvParameters,
+                        UBaseType_t uxPriority,
+                        TaskHandle_t * const pxCreatedTask,
+                        uint8_t ucReplicatedType,
+                        StackType_t * const puxStackBuffers,
+                        StaticTask_t * const pxTaskBuffers,
+                        StaticReplicatedGroup_t * const pxGroupBuffer,
+                        RedundantValueErrorCb_t pxRedundantValueErrorCb );</pre>
+*
+* Create a new replicated task without allocating memory, see
+* xTaskCreateStatic() and xTaskCreateReplicated(). Memory of the TCBs, the
+* stacks and the group descriptor is provided by the application writer, so
+* creation doesn't depend on the heap. Deleting the group doesn't free it.
+*
+* taskREPLICATED_RESPAWN creates a diverged replica again in its own TCB and
+* stack, so respawn works without the heap too. State blocks of
+* pvTaskGetReplicatedState() are still allocated on the first call.
+*
+* @param ucReplicatedType Number of replicas, see xTaskCreateReplicated().
+*
+* @param puxStackBuffers Must point to a StackType_t array that has at least
+* ulStackDepth indexes per replica. Replica n uses indexes from
+* n * ulStackDepth.
+*
+* @param pxTaskBuffers Must point to an array of StaticTask_t with an element
+* per replica.
+*
+* @param pxGroupBuffer Must point to a variable of type
+* StaticReplicatedGroup_t, which will then be used to hold the group.
+*
+* Rest of the parameters and return value are the same as in
+* xTaskCreateReplicated().
+*
+* \defgroup xTaskCreateReplicatedStatic xTaskCreateReplicatedStatic
+* \ingroup Tasks
+*/
+#if( ( INCLUDE_xTaskCreateReplicated == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) )
+    BaseType_t xTaskCreateReplicatedStatic( TaskFunction_t pxTaskCode,
+                            const char * const pcName,
+                            const uint32_t ulStackDepth,
+                            void * const pvParameters,
+                            UBaseType_t uxPriority,
+                            TaskHandle_t * const pxCreatedTask,
+                            uint8_t ucReplicatedType,
+                            StackType_t * const puxStackBuffers,
+                            StaticTask_t * const pxTaskBuffers,
+                            StaticReplicatedGroup_t * const pxGroupBuffer,
+                            RedundantValueErrorCb_t pxRedundantValueErrorCb );
+#endif
+
+/**
+* task. h
+*<pre>
+BaseType_t xTaskCreateReplicatedPipelined( TaskFunction_t pxTaskCode,
+                        const char * const pcName,
+                        const configSTACK_DEPTH_TYPE usStackDepth,
+                        void * const pvParameters,
+                        UBaseType_t uxPriority,
+                        TaskHandle_t * const pxCreatedTask,
+                        uint8_t ucReplicatedType,
+                        UBaseType_t uxSkew,
+                        RedundantValueErrorCb_t pxRedundantValueErrorCb );</pre>
+*
+* Create a replicated task whose replicas don't run in lockstep. On
+* vTaskSyncAndCompare the compare value is pushed into a ring of uxSkew entries
+* owned by the replica and the replica continues. It is blocked only when it
+* is uxSkew synchronization points ahead of the slowest replica. Rounds
+* every replica pushed are compared in order by the replica that completed
+* them, so compare work is not duplicated and no separate voter task is
+* needed.
+*
+* A mismatch is reported with pxRedundantValueErrorCb like in lockstep groups,
+* possibly up to uxSkew synchronization points after it happened.
+* ReplicatedMismatch_t::ulSyncIndex tells which synchronization point
+* diverged. Diverged replicas can't be respawned, as their state has already
+* moved on. With taskREPLICATED_RESPAWN the group continues if a majority
+* agrees, the diverged replicas are in ReplicatedMismatch_t::ulDivergedMask,
+* otherwise the group is deleted.
+*
+* @param ucReplicatedType Number of replicas, see xTaskCreateReplicated().
+* taskREPLICATED_EARLY_RELEASE is not supported.
+*
+* @param uxSkew Maximum number of synchronization points a replica can be
+* ahead of the comparison. Has to be at least 1. Memory of the group grows by
+* uxSkew compare values per replica.
+*
+* Rest of the parameters and return value are the same as in
+* xTaskCreateReplicated().
+*
+* \defgroup xTaskCreateReplicatedPipelined xTaskCreateReplicatedPipelined
+* \ingroup Tasks
+*/
+#if( INCLUDE_xTaskCreateReplicated == 1 )
+    BaseType_t xTaskCreateReplicatedPipelined( TaskFunction_t pxTaskCode,
+                            const char * const pcName,
+                            const configSTACK_DEPTH_TYPE usStackDepth,
+                            void * const pvParameters,
+                            UBaseType_t uxPriority,
+                            TaskHandle_t * const pxCreatedTask,
+                            uint8_t ucReplicatedType,
+                            UBaseType_t uxSkew,
+                            RedundantValueErrorCb_t pxRedundantValueErrorCb );
+#endif
+
 /**
 * task. h
 * <pre>void xTaskSetCompareValue( CompareValue_t xNewCompareValue );</pre>
@@ -677,12 +1079,48 @@ TaskHandle_t xHandle = NULL;
     void vTaskSetCompareValue( CompareValue_t xNewCompareValue );
 #endif
 
+/**
+* task. h
+* <pre>BaseType_t xTaskRecordCompareValue( CompareValue_t xCompareValue );</pre>
+*
+* Records a checkpoint value of the calling replica without synchronizing.
+* Up to configMAX_REPLICATED_CHECKPOINTS values can be recorded between two
+* calls to vTaskSyncAndCompare. On the synchronization point the recorded
+* values are compared in order, followed by the value of vTaskSyncAndCompare,
+* so a loop can be checked at fine grain for the cost of one synchronization.
+* pxRedundantValueErrorCb gets the values of the first diverged checkpoint and
+* its index is in ReplicatedMismatch_t::uxCheckpoint. The index equals the
+* number of recorded checkpoints when only the value of vTaskSyncAndCompare
+* diverged. A replica that recorded fewer checkpoints than others is compared
+* with its vTaskSyncAndCompare value in place of the missing ones.
+*
+* In pipelined groups, see xTaskCreateReplicatedPipelined(), the recorded
+* values are folded into the value pushed on vTaskSyncAndCompare with the
+* compare digest, so there is still one entry and one comparison per
+* synchronization point. A mismatch then tells the synchronization point, but
+* ReplicatedMismatch_t::uxCheckpoint is always 0.
+*
+* @param xCompareValue Checkpoint value to record.
+*
+* @return pdPASS if the value was recorded, pdFAIL if
+* configMAX_REPLICATED_CHECKPOINTS values are already recorded.
+*
+* \defgroup xTaskRecordCompareValue xTaskRecordCompareValue
+* \ingroup TaskCtrl
+*/
+#if( INCLUDE_xTaskCreateReplicated == 1 )
+    BaseType_t xTaskRecordCompareValue( CompareValue_t xCompareValue );
+#endif
+
 /**
 * task. h
 * <pre>void vTaskTimedReset( TaskHandle_t pxTaskHandle );</pre>
 *
 * Reset the timer of the timed task.
 *
+* If the task is scheduled by deadline, see configUSE_TIMED_EDF, it gets the
+* deadline of its next job and the task with the earliest deadline runs.
+*
 * @warning Shall only be used for timed tasks.
 *
 * @param pxTaskHandle Handle of the task whose timer shall be reset.
@@ -705,6 +1143,348 @@ void vTimedTask( void * pvParameters )
 */
 void vTaskTimedReset( TaskHandle_t pxTaskHandle );
 
+/**
+* task. h
+* <pre>void vTaskTimedBudgetExpiredFromISR( BaseType_t * const pxHigherPriorityTaskWoken );</pre>
+*
+* Called from the interrupt armed with configTIMED_BUDGET_ARM(). Checks the
+* overrun budget of the running task with the current run time counter value,
+* so the overrun is detected within the slice instead of on the next switch.
+* If the interrupt came early it is armed again for the rest of the budget.
+*
+* Only available if configTIMED_BUDGET_IN_RUN_TIME_COUNTS is set to 1. The
+* interrupt priority must allow calling FreeRTOS API functions.
+*
+* @param pxHigherPriorityTaskWoken Set to pdTRUE if the timer daemon was woken
+* to call the overrun callback and a context switch should be requested before
+* the interrupt exits.
+*
+* Example usage:
+<pre>
+void vRunTimeCounterCompareISR( void )
+{
+BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+
+    // Clear and disable the compare interrupt.
+
+    vTaskTimedBudgetExpiredFromISR( &xHigherPriorityTaskWoken );
+    portYIELD_FROM_ISR( xHigherPriorityTaskWoken );
+}
+</pre>
+* \defgroup vTaskTimedBudgetExpiredFromISR vTaskTimedBudgetExpiredFromISR
+* \ingroup TaskCtrl
+*/
+#if( ( INCLUDE_xTaskCreateTimed == 1 ) && ( configTIMED_BUDGET_IN_RUN_TIME_COUNTS == 1 ) )
+    void vTaskTimedBudgetExpiredFromISR( BaseType_t * const pxHigherPriorityTaskWoken );
+#endif
+
+/**
+* task. h
+* <pre>BaseType_t xTaskGetTimedStats( TaskHandle_t xTask, TimedStats_t * const pxStats );</pre>
+*
+* Copies the execution time statistics of the timed task. A job is the run
+* time of the task between two calls to vTaskTimedReset(), so the first job
+* ends with the first reset. Times are in run time counts.
+*
+* The copy doesn't block the jobs of the task. If a job ends during the copy,
+* the copy is repeated, so all fields are from the same moment.
+*
+* Only available if configUSE_TIMED_TASK_STATS is set to 1.
+*
+* @warning Shall only be used for timed tasks.
+*
+* @param xTask Handle of the task to be queried.  Passing a NULL handle results
+* in getting the statistics of the calling task.
+*
+* @param pxStats Filled with the statistics.
+*
+* @return pdPASS.
+*
+* Example usage:
+<pre>
+void vPrintStats( TaskHandle_t xTimedTask )
+{
+TimedStats_t xStats;
+
+    xTaskGetTimedStats( xTimedTask, &xStats );
+
+    // Budget with margin above the longest job seen so far.
+    printf( "jobs %u mean %u wcet %u\n", xStats.ulJobs, xStats.ulMean, xStats.ulWcet );
+}
+</pre>
+* \defgroup xTaskGetTimedStats xTaskGetTimedStats
+* \ingroup TaskCtrl
+*/
+#if( ( INCLUDE_xTaskCreateTimed == 1 ) && ( configUSE_TIMED_TASK_STATS == 1 ) )
+    BaseType_t xTaskGetTimedStats( TaskHandle_t xTask, TimedStats_t * const pxStats );
+#endif
+
+/**
+* task. h
+* <pre>void vTaskTimedStatsClear( TaskHandle_t xTask );</pre>
+*
+* Clears the execution time statistics of the timed task, except for the
+* WCET, which is kept for the whole life of the task.
+*
+* Only available if configUSE_TIMED_TASK_STATS is set to 1.
+*
+* @param xTask Handle of the task.  Passing a NULL handle results in clearing
+* the statistics of the calling task.
+*
+* \defgroup vTaskTimedStatsClear vTaskTimedStatsClear
+* \ingroup TaskCtrl
+*/
+#if( ( INCLUDE_xTaskCreateTimed == 1 ) && ( configUSE_TIMED_TASK_STATS == 1 ) )
+    void vTaskTimedStatsClear( TaskHandle_t xTask );
+#endif
+
+/**
+* task. h
+* <pre>BaseType_t xTaskTimedSetEnforcement( TaskHandle_t xTask, eTimedEnforcement eEnforcement, TickType_t xReplenishPeriod );</pre>
+*
+* Sets what the kernel does when the timed task runs out of its overrun time,
+* so a task that overruns can't starve the rest of the system and still makes
+* progress. With eTimedEnforceNone, the default, the overrun time restarts
+* after the callback like before.
+*
+* With an enforcement, the overrun time is a budget that is only replenished
+* by the kernel, vTaskTimedReset() doesn't restart it. eTimedEnforceDemote and
+* eTimedEnforceSuspend replenish the budget every xReplenishPeriod ticks,
+* counted from the call. eTimedEnforceSporadic replenishes it xReplenishPeriod
+* ticks after the task started to use it, like a sporadic server.
+*
+* A demoted task only has its running priority changed. If it inherits a
+* priority from a mutex, it gets its base priority back on the disinheritance.
+*
+* @warning Shall only be used for timed tasks created with an overrun time.
+*
+* @param xTask Handle of the task.  Passing a NULL handle results in setting
+* the enforcement of the calling task.
+*
+* @param eEnforcement Action on the overrun, see eTimedEnforcement.
+*
+* @param xReplenishPeriod Replenishment period in ticks. Not used with
+* eTimedEnforceNone.
+*
+* @return pdPASS if the enforcement was set, pdFAIL if the period is 0.
+*
+* Example usage:
+<pre>
+void vTimedTask( void * pvParameters )
+{
+    // At most 2 ms of every 10 ms, the rest at the throttle priority.
+    xTaskTimedSetEnforcement( NULL, eTimedEnforceDemote, pdMS_TO_TICKS( 10 ) );
+
+    for( ;; )
+    {
+        // Task code goes here.
+    }
+}
+</pre>
+* \defgroup xTaskTimedSetEnforcement xTaskTimedSetEnforcement
+* \ingroup TaskCtrl
+*/
+#if( INCLUDE_xTaskCreateTimed == 1 )
+    BaseType_t xTaskTimedSetEnforcement( TaskHandle_t xTask, eTimedEnforcement eEnforcement, TickType_t xReplenishPeriod );
+#endif
+
+/**
+* task. h
+* <pre>void vTaskTimedWaitForNextPeriod( void );</pre>
+*
+* Ends the current job of the calling periodic task and blocks it until the
+* next job is released, see xTaskCreateTimedPeriodic(). If the job ended after
+* the next one was due, the next job starts right away and the delay counts as
+* release jitter. Releases stay on the grid of the period, they don't drift
+* with late jobs.
+*
+* @warning Shall only be used by tasks created with xTaskCreateTimedPeriodic().
+*
+* \defgroup vTaskTimedWaitForNextPeriod vTaskTimedWaitForNextPeriod
+* \ingroup TaskCtrl
+*/
+#if( INCLUDE_xTaskCreateTimed == 1 )
+    void vTaskTimedWaitForNextPeriod( void );
+#endif
+
+/**
+* task. h
+* <pre>uint32_t ulTaskTimedGetBudgetWarnings( TaskHandle_t xTask );</pre>
+*
+* Returns how many times the timed task used more than
+* configTIMED_BUDGET_WARNING_PERCENT of its overrun time, counted once until
+* the overrun time restarts. So it can be seen how often the task comes close
+* to its limit before the overrun callback is called.
+*
+* With configUSE_TIMED_SUPERVISOR set to 1, every warning is also posted to the
+* supervisor as eTimedEventWarning, so it can shed load or boost the priority
+* before the overrun. The warning isn't forwarded to the timer service task.
+* If configUSE_TIMED_TASK_STATS is set to 1, the count is also a part of
+* TimedStats_t and is cleared with vTaskTimedStatsClear().
+*
+* Only available if configUSE_TIMED_BUDGET_WARNING is set to 1.
+*
+* @warning Shall only be used for timed tasks created with an overrun time.
+*
+* @param xTask Handle of the task to be queried.  Passing a NULL handle results
+* in getting the count of the calling task.
+*
+* @return Number of warnings since the task was created or its statistics
+* were cleared.
+*
+* \defgroup ulTaskTimedGetBudgetWarnings ulTaskTimedGetBudgetWarnings
+* \ingroup TaskCtrl
+*/
+#if( ( INCLUDE_xTaskCreateTimed == 1 ) && ( configUSE_TIMED_BUDGET_WARNING == 1 ) )
+    uint32_t ulTaskTimedGetBudgetWarnings( TaskHandle_t xTask );
+#endif
+
+/**
+* task. h
+* <pre>BaseType_t xTaskTimedSetCriticality( TaskHandle_t xTask, eTimedCriticality eCriticality, TickType_t xOverrunTimeHi );</pre>
+*
+* Sets the criticality level of the timed task. Timed tasks take part in the
+* mode of the kernel only once their criticality is set.
+*
+* The kernel starts in LO mode, where every task runs on the overrun time it
+* was created with. When a HI task runs out of that overrun time, the kernel
+* switches to HI mode instead of forwarding the overrun. In HI mode HI tasks
+* run on xOverrunTimeHi, and their overrun is forwarded only when it runs out
+* too. LO tasks are demoted to configTIMED_HI_MODE_LO_PRIORITY, which at the
+* idle priority holds them back until the kernel returns to LO mode. The
+* kernel returns to LO mode when the idle task runs, as no HI task is ready
+* then.
+*
+* The overrun time of the task restarts.
+*
+* Only available if configUSE_TIMED_CRITICALITY is set to 1.
+*
+* @warning Shall only be used for timed tasks. HI tasks shall be created with
+* an overrun time.
+*
+* @param xTask Handle of the task.  Passing a NULL handle results in setting
+* the criticality of the calling task.
+*
+* @param eCriticality Criticality level of the task.
+*
+* @param xOverrunTimeHi Overrun time in HI mode, in the units of the overrun
+* time of xTaskCreateTimed(). Not used for LO tasks.
+*
+* @return pdPASS if the criticality was set, pdFAIL if xOverrunTimeHi of a HI
+* task is below the overrun time it was created with.
+*
+* Example usage:
+<pre>
+void vControlTask( void * pvParameters )
+{
+    // 2 ms normally, up to 5 ms when the system is overloaded.
+    xTaskTimedSetCriticality( NULL, eTimedCriticalityHi, taskUS_TO_OVERRUN_TIME( 5000 ) );
+
+    for( ;; )
+    {
+        // Task code goes here.
+
+        vTaskTimedReset( NULL );
+    }
+}
+</pre>
+* \defgroup xTaskTimedSetCriticality xTaskTimedSetCriticality
+* \ingroup TaskCtrl
+*/
+#if( ( INCLUDE_xTaskCreateTimed == 1 ) && ( configUSE_TIMED_CRITICALITY == 1 ) )
+    BaseType_t xTaskTimedSetCriticality( TaskHandle_t xTask, eTimedCriticality eCriticality, TickType_t xOverrunTimeHi );
+#endif
+
+/**
+* task. h
+* <pre>eTimedCriticality eTaskTimedGetMode( void );</pre>
+*
+* Only available if configUSE_TIMED_CRITICALITY is set to 1.
+*
+* @return eTimedCriticalityHi if the kernel is in HI mode, see
+* xTaskTimedSetCriticality(), eTimedCriticalityLo otherwise.
+*
+* \defgroup eTaskTimedGetMode eTaskTimedGetMode
+* \ingroup TaskCtrl
+*/
+#if( ( INCLUDE_xTaskCreateTimed == 1 ) && ( configUSE_TIMED_CRITICALITY == 1 ) )
+    eTimedCriticality eTaskTimedGetMode( void );
+#endif
+
+/**
+* task. h
+* <pre>void vTaskTimedSetSupervisor( TaskHandle_t xSupervisor );</pre>
+*
+* Sets the task that receives the overrun and overflow events of all timed
+* tasks. Events are posted by the tick interrupt, the context switch or
+* vTaskTimedBudgetExpiredFromISR() and the supervisor is woken by a
+* notification, so it handles them without waiting for the timer service
+* task. The callbacks of the timed tasks aren't called for events posted to
+* the supervisor.
+*
+* Up to configTIMED_EVENT_QUEUE_LENGTH events wait for the supervisor. If
+* there is no room, the event goes to the timer service task and the callback
+* is called like without a supervisor.
+*
+* Only available if configUSE_TIMED_SUPERVISOR is set to 1. The supervisor
+* uses the notification value of the task, it shall not be notified by other
+* means.
+*
+* @param xSupervisor Handle of the supervisor. Passing NULL forwards the
+* events to the timer service task again, which shall be done before the
+* supervisor is deleted. Events still waiting for the supervisor are dropped.
+*
+* \defgroup vTaskTimedSetSupervisor vTaskTimedSetSupervisor
+* \ingroup TaskCtrl
+*/
+#if( ( INCLUDE_xTaskCreateTimed == 1 ) && ( configUSE_TIMED_SUPERVISOR == 1 ) )
+    void vTaskTimedSetSupervisor( TaskHandle_t xSupervisor );
+#endif
+
+/**
+* task. h
+* <pre>BaseType_t xTaskTimedReceiveEvent( TimedEvent_t * const pxEvent, TickType_t xTicksToWait );</pre>
+*
+* Takes the oldest event posted to the supervisor, see
+* vTaskTimedSetSupervisor(). Shall only be called by the supervisor.
+*
+* Only available if configUSE_TIMED_SUPERVISOR is set to 1.
+*
+* @param pxEvent Filled with the event.
+*
+* @param xTicksToWait The maximum amount of time the task should block
+* waiting for an event.
+*
+* @return pdPASS if an event was received, pdFAIL if xTicksToWait expired
+* first.
+*
+* Example usage:
+<pre>
+void vSupervisorTask( void * pvParameters )
+{
+TimedEvent_t xEvent;
+
+    vTaskTimedSetSupervisor( xTaskGetCurrentTaskHandle() );
+
+    for( ;; )
+    {
+        if( xTaskTimedReceiveEvent( &xEvent, portMAX_DELAY ) == pdPASS )
+        {
+            if( xEvent.eEvent == eTimedEventOverrun )
+            {
+                // Shed load of xEvent.xTask.
+            }
+        }
+    }
+}
+</pre>
+* \defgroup xTaskTimedReceiveEvent xTaskTimedReceiveEvent
+* \ingroup TaskCtrl
+*/
+#if( ( INCLUDE_xTaskCreateTimed == 1 ) && ( configUSE_TIMED_SUPERVISOR == 1 ) )
+    BaseType_t xTaskTimedReceiveEvent( TimedEvent_t * const pxEvent, TickType_t xTicksToWait );
+#endif
+
 /**
 * task. h
 * <pre>eTaskType eTaskGetType( TaskHandle_t pxTaskHandle );</pre>
@@ -750,6 +1530,201 @@ void vReplicatedTask( void * pvParameters )
 #if( INCLUDE_xTaskCreateReplicated == 1 )
     void vTaskSyncAndCompare( const CompareValue_t * const pxNewCompareValue );
 #endif
+
+/**
+* task. h
+* <pre>uint8_t ucTaskVoteCompareValues( const CompareValue_t * const pxCompareValues,
+                                 const uint8_t ucValuesLen,
+                                 CompareValue_t * const pxVotedValue );</pre>
+*
+* Plurality voter for compare values of replicated tasks. Finds the value that
+* appears most often. Intended to be used from RedundantValueErrorCb_t.
+*
+* @param pxCompareValues Array of compare values.
+*
+* @param ucValuesLen Number of elements in pxCompareValues. Shall be at least 1.
+*
+* @param pxVotedValue The most common value is written here. On a tie the value
+* with the lowest index wins. Can be NULL.
+*
+* @return Number of values equal to the voted value. Majority exists if the
+* returned value is greater than ucValuesLen / 2.
+*
+* \defgroup ucTaskVoteCompareValues ucTaskVoteCompareValues
+* \ingroup TaskCtrl
+*/
+#if( INCLUDE_xTaskCreateReplicated == 1 )
+    uint8_t ucTaskVoteCompareValues( const CompareValue_t * const pxCompareValues,
+                                     const uint8_t ucValuesLen,
+                                     CompareValue_t * const pxVotedValue );
+#endif
+
+/**
+* task. h
+* <pre>void vTaskCompareDigestReset( void );</pre>
+*
+* Starts a new compare digest of the calling replicated task. Digest replaces
+* the compare value, so wide outputs can be compared without hand made
+* checksums. Digest is CRC-32/MPEG-2 of all bytes fed in since the reset, see
+* compare_digest.h.
+*
+* @warning Shall only be used for replicated tasks.
+*
+* Example usage:
+<pre>
+void vReplicatedTask( void * pvParameters )
+{
+    for( ;; )
+    {
+        // Task code goes here, output is written to xOutput and xState.
+
+        vTaskCompareDigestReset();
+        vTaskCompareDigestUpdate( &xOutput, sizeof( xOutput ) );
+        vTaskCompareDigestUpdate( &xState, sizeof( xState ) );
+
+        // NULL compares the digest.
+        vTaskSyncAndCompare( NULL );
+    }
+}
+</pre>
+* \defgroup vTaskCompareDigestReset vTaskCompareDigestReset
+* \ingroup TaskCtrl
+*/
+#if( INCLUDE_xTaskCreateReplicated == 1 )
+    void vTaskCompareDigestReset( void );
+#endif
+
+/**
+* task. h
+* <pre>void vTaskCompareDigestUpdate( const void * pvData, size_t xLength );</pre>
+*
+* Feeds a byte range into the compare digest of the calling replicated task.
+* Cost is linear in xLength, data is processed a word at a time.
+*
+* @warning Shall only be used for replicated tasks.
+*
+* @param pvData Start of the data.
+*
+* @param xLength Number of bytes to feed.
+*
+* \defgroup vTaskCompareDigestUpdate vTaskCompareDigestUpdate
+* \ingroup TaskCtrl
+*/
+#if( INCLUDE_xTaskCreateReplicated == 1 )
+    void vTaskCompareDigestUpdate( const void * pvData, size_t xLength );
+#endif
+
+/**
+* task. h
+* <pre>void vTaskCompareDigestUpdateScatter( const CompareDigestSegment_t * pxSegments, UBaseType_t uxSegments );</pre>
+*
+* Feeds a list of byte ranges into the compare digest of the calling replicated
+* task. Same as calling vTaskCompareDigestUpdate() for every segment in order.
+*
+* @warning Shall only be used for replicated tasks.
+*
+* @param pxSegments Array of segments.
+*
+* @param uxSegments Number of segments in pxSegments.
+*
+* \defgroup vTaskCompareDigestUpdateScatter vTaskCompareDigestUpdateScatter
+* \ingroup TaskCtrl
+*/
+#if( INCLUDE_xTaskCreateReplicated == 1 )
+    void vTaskCompareDigestUpdateScatter( const CompareDigestSegment_t * pxSegments,
+                                          UBaseType_t uxSegments );
+#endif
+
+/**
+* task. h
+* <pre>BaseType_t xTaskGetReplicatedMismatch( TaskHandle_t xTask, ReplicatedMismatch_t * pxMismatch );</pre>
+*
+* Gets the result of the last comparison of the replicated group. Shows which
+* replicas diverged from the voted value. Can be used from
+* RedundantValueErrorCb_t, where it describes the current mismatch.
+*
+* @param xTask Handle of any replica of the group. Passing a NULL handle
+* results in using the calling task.
+*
+* @param pxMismatch Result is copied here.
+*
+* @return pdTRUE if the last comparison found a mismatch, otherwise pdFALSE.
+*
+* \defgroup xTaskGetReplicatedMismatch xTaskGetReplicatedMismatch
+* \ingroup TaskCtrl
+*/
+#if( INCLUDE_xTaskCreateReplicated == 1 )
+    BaseType_t xTaskGetReplicatedMismatch( TaskHandle_t xTask,
+                                           ReplicatedMismatch_t * pxMismatch );
+#endif
+
+/**
+* task. h
+* <pre>UBaseType_t uxTaskGetReplicaIndex( TaskHandle_t xTask );</pre>
+*
+* Gets the index of the replica in its group. Index n corresponds to bit n of
+* ReplicatedMismatch_t::ulDivergedMask and to element n of the compare values
+* passed to RedundantValueErrorCb_t.
+*
+* @param xTask Handle of the replica. Passing a NULL handle results in using
+* the calling task.
+*
+* \defgroup uxTaskGetReplicaIndex uxTaskGetReplicaIndex
+* \ingroup TaskCtrl
+*/
+#if( INCLUDE_xTaskCreateReplicated == 1 )
+    UBaseType_t uxTaskGetReplicaIndex( TaskHandle_t xTask );
+#endif
+
+/**
+* task. h
+* <pre>void * pvTaskGetReplicatedState( size_t xStateSize );</pre>
+*
+* Gets the state block of the calling replica. The block is owned by the
+* kernel and survives a respawn of the replica. If RedundantValueErrorCb_t
+* returns taskREPLICATED_RESPAWN, every diverged replica is deleted, its state
+* block is overwritten with the state block of a replica that agrees with the
+* voted value and the replica is created again in its own TCB and stack. A
+* replica that diverged and found the mismatch itself is created again by the
+* idle task. The new task starts from the task entry function, so it shall get
+* its state with this function before it uses it. If there is no majority, all replicas are deleted
+* instead.
+*
+* The first call from any replica of the group allocates zeroed blocks for
+* the whole group. Every replica shall pass the same size. Blocks are freed
+* when the group is deleted.
+*
+* @warning Shall only be used for replicated tasks.
+*
+* @param xStateSize Size of the state block in bytes.
+*
+* @return Pointer to the state block, NULL if it couldn't be allocated.
+*
+* Example usage:
+<pre>
+uint8_t ucCompareErrorCb( CompareValue_t * pxCompareValues, uint8_t ucLen )
+{
+    return taskREPLICATED_RESPAWN;
+}
+
+void vReplicatedTask( void * pvParameters )
+{
+State_t * pxState = pvTaskGetReplicatedState( sizeof( State_t ) );
+
+    for( ;; )
+    {
+        // Task code goes here, everything that has to be kept is in pxState.
+
+        vTaskSyncAndCompare( &pxState->xOutput );
+    }
+}
+</pre>
+* \defgroup pvTaskGetReplicatedState pvTaskGetReplicatedState
+* \ingroup TaskCtrl
+*/
+#if( INCLUDE_xTaskCreateReplicated == 1 )
+    void * pvTaskGetReplicatedState( size_t xStateSize );
+#endif
 /**
  * task. h
  *<pre>
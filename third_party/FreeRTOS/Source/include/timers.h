@@ -51,6 +51,7 @@ be used solely through the macros that make up the public software timer API,
 as defined below.  The commands that are sent from interrupts must use the
 highest numbers as tmrFIRST_FROM_ISR_COMMAND is used to determine if the task
 or interrupt version of the queue send function should be used. */
+#define tmrCOMMAND_NONE							( ( BaseType_t ) -3 ) /* Left in place of a command cancelled by coalescing. */
 #define tmrCOMMAND_EXECUTE_CALLBACK_FROM_ISR 	( ( BaseType_t ) -2 )
 #define tmrCOMMAND_EXECUTE_CALLBACK				( ( BaseType_t ) -1 )
 #define tmrCOMMAND_START_DONT_TRACE				( ( BaseType_t ) 0 )
@@ -426,6 +427,35 @@ TaskHandle_t xTimerGetTaskHandle( const TimerHandle_t xTimer ) PRIVILEGED_FUNCTI
  */
 void vTimerSetTimerID( TimerHandle_t xTimer, void *pvNewID ) PRIVILEGED_FUNCTION;
 
+/**
+ * void vTimerSetSlack( TimerHandle_t xTimer, const TickType_t xSlackInTicks );
+ *
+ * Sets how many ticks after its expiry time the callback of the timer may be
+ * called.  The timer service task wakes at the latest time no timer is late by
+ * more than its slack, and processes all timers that expired by then in that
+ * wakeup.  Timers have no slack when they are created.
+ *
+ * configUSE_TIMER_SLACK must be set to 1 for this function to be available.
+ *
+ * @param xTimer The timer being updated.
+ *
+ * @param xSlackInTicks The ticks the callback may be late.
+ */
+void vTimerSetSlack( TimerHandle_t xTimer, const TickType_t xSlackInTicks ) PRIVILEGED_FUNCTION;
+
+/**
+ * TickType_t xTimerGetSlack( TimerHandle_t xTimer );
+ *
+ * Returns the slack of the timer set with vTimerSetSlack().
+ *
+ * configUSE_TIMER_SLACK must be set to 1 for this function to be available.
+ *
+ * @param xTimer The timer being queried.
+ *
+ * @return The ticks the callback of the timer may be late.
+ */
+TickType_t xTimerGetSlack( TimerHandle_t xTimer ) PRIVILEGED_FUNCTION;
+
 /**
  * BaseType_t xTimerIsTimerActive( TimerHandle_t xTimer );
  *
@@ -463,6 +493,53 @@ void vTimerSetTimerID( TimerHandle_t xTimer, void *pvNewID ) PRIVILEGED_FUNCTION
  */
 BaseType_t xTimerIsTimerActive( TimerHandle_t xTimer ) PRIVILEGED_FUNCTION;
 
+/**
+ * void vTimerSetLane( TimerHandle_t xTimer, const UBaseType_t uxLane );
+ *
+ * Moves the timer to another timer service lane.  Every lane has its own timer
+ * service task, priority and command channel, so the callbacks of a lane are
+ * not delayed by the callbacks of lower priority lanes.  Timers are created in
+ * lane 0, which runs at configTIMER_TASK_PRIORITY.  The timers of timed tasks
+ * are created in lane configTIMER_KERNEL_LANE.
+ *
+ * The timer must be dormant and no command for it may be pending, for example
+ * right after it was created.  Otherwise the timer stays in its current lane.
+ *
+ * configTIMER_SERVICE_LANES must be more than 1 for this function to be
+ * available.
+ *
+ * @param xTimer The timer being moved.
+ *
+ * @param uxLane The lane, less than configTIMER_SERVICE_LANES.
+ */
+void vTimerSetLane( TimerHandle_t xTimer, const UBaseType_t uxLane ) PRIVILEGED_FUNCTION;
+
+/**
+ * UBaseType_t uxTimerGetLane( TimerHandle_t xTimer );
+ *
+ * Returns the timer service lane of the timer.
+ *
+ * configTIMER_SERVICE_LANES must be more than 1 for this function to be
+ * available.
+ *
+ * @param xTimer The timer being queried.
+ *
+ * @return The lane of the timer.
+ */
+UBaseType_t uxTimerGetLane( TimerHandle_t xTimer ) PRIVILEGED_FUNCTION;
+
+/**
+ * TaskHandle_t xTimerGetLaneTaskHandle( const UBaseType_t uxLane );
+ *
+ * Returns the handle of the timer service task of the lane.  The task of lane
+ * 0 is the one returned by xTimerGetTimerDaemonTaskHandle().  It is not valid
+ * to call xTimerGetLaneTaskHandle() before the scheduler has been started.
+ *
+ * configTIMER_SERVICE_LANES must be more than 1 for this function to be
+ * available.
+ */
+TaskHandle_t xTimerGetLaneTaskHandle( const UBaseType_t uxLane ) PRIVILEGED_FUNCTION;
+
 /**
  * TaskHandle_t xTimerGetTimerDaemonTaskHandle( void );
  *
@@ -103,6 +103,10 @@ extern void vPortExitCritical( void );
 #define portENTER_CRITICAL()					vPortEnterCritical()
 #define portEXIT_CRITICAL()						vPortExitCritical()
 
+/* Stops the compiler from moving memory accesses across it. A single core
+needs no hardware barrier to order accesses seen by its interrupts. */
+#define portMEMORY_BARRIER()					__asm volatile( "" ::: "memory" )
+
 /*-----------------------------------------------------------*/
 
 /* Task function macros as described on the FreeRTOS.org WEB site.  These are
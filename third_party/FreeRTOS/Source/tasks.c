@@ -40,6 +40,10 @@ task.h is included from an application file. */
 #include "timers.h"
 #include "stack_macros.h"
 
+#if( INCLUDE_xTaskCreateReplicated == 1 )
+    #include "compare_digest.h"
+#endif
+
 /* Lint e961 and e750 are suppressed as a MISRA exception justified because the
 MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined for the
 header files above, but not in this file, in order to generate the correct
@@ -89,13 +93,16 @@ made to free the RAM that was allocated statically.
 tskSTATIC_AND_DYNAMIC_ALLOCATION_POSSIBLE is only true if it is possible for a
 task to be created using either statically or dynamically allocated RAM.  Note
 that if portUSING_MPU_WRAPPERS is 1 then a protected task can be created with
-a statically allocated stack and a dynamically allocated TCB.
+a statically allocated stack and a dynamically allocated TCB. Replicated
+groups allocate the TCBs and stacks of their replicas in one block, so that is
+tracked too.
 !!!NOTE!!! If the definition of tskSTATIC_AND_DYNAMIC_ALLOCATION_POSSIBLE is
 changed then the definition of StaticTask_t must also be updated. */
-#define tskSTATIC_AND_DYNAMIC_ALLOCATION_POSSIBLE	( ( configSUPPORT_STATIC_ALLOCATION == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+#define tskSTATIC_AND_DYNAMIC_ALLOCATION_POSSIBLE	( ( ( configSUPPORT_STATIC_ALLOCATION == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) ) || ( INCLUDE_xTaskCreateReplicated == 1 ) )
 #define tskDYNAMICALLY_ALLOCATED_STACK_AND_TCB 		( ( uint8_t ) 0 )
 #define tskSTATICALLY_ALLOCATED_STACK_ONLY 			( ( uint8_t ) 1 )
 #define tskSTATICALLY_ALLOCATED_STACK_AND_TCB		( ( uint8_t ) 2 )
+#define tskGROUP_ALLOCATED_STACK_AND_TCB			( ( uint8_t ) 3 )
 
 /* If any of the following are set then task stacks are filled with a known
 value so the high water mark can be determined.  If none of the following are
@@ -115,6 +122,12 @@ set then don't fill the stack so there is no unnecessary dependency on memset. *
 #define tskDELETED_CHAR		( 'D' )
 #define tskSUSPENDED_CHAR	( 'S' )
 
+/* Job states of timed tasks. Only periodic tasks wait for a release, other
+timed tasks are always in tskJOB_STARTED. */
+#define tskJOB_RELEASED		( ( uint8_t ) 0 )
+#define tskJOB_STARTED		( ( uint8_t ) 1 )
+#define tskJOB_WAITING		( ( uint8_t ) 2 )
+
 /*
  * Some kernel aware debuggers require the data the debugger needs access to be
  * global, rather than file scope.
@@ -129,6 +142,68 @@ configIDLE_TASK_NAME in FreeRTOSConfig.h. */
 	#define configIDLE_TASK_NAME "IDLE"
 #endif
 
+#if( ( INCLUDE_xTaskCreateTimed == 1 ) && ( configUSE_TIMED_EDF == 1 ) )
+
+	/* The ready list of configTIMED_EDF_PRIORITY is kept in order of absolute
+	deadline, so the task with the earliest deadline is always at its head.
+	Tasks with the same deadline are taken round robin. */
+	#define taskGET_OWNER_OF_READY_ENTRY( pxTCB, uxPriority )											\
+	{																									\
+		if( ( uxPriority ) == ( UBaseType_t ) configTIMED_EDF_PRIORITY )								\
+		{																								\
+			( pxTCB ) = prvSelectTimedReadyTask();														\
+		}																								\
+		else																							\
+		{																								\
+			listGET_OWNER_OF_NEXT_ENTRY( ( pxTCB ), &( pxReadyTasksLists[ ( uxPriority ) ] ) );			\
+		}																								\
+	}
+
+	#define taskINSERT_INTO_READY_LIST( pxTCB )															\
+	{																									\
+		if( ( pxTCB )->uxPriority == ( UBaseType_t ) configTIMED_EDF_PRIORITY )						\
+		{																								\
+			listSET_LIST_ITEM_VALUE( &( ( pxTCB )->xStateListItem ), prvGetTimedDeadline( pxTCB ) );	\
+			prvInsertTimedReadyList( &( ( pxTCB )->xStateListItem ) );									\
+		}																								\
+		else																							\
+		{																								\
+			vListInsertEnd( &( pxReadyTasksLists[ ( pxTCB )->uxPriority ] ), &( ( pxTCB )->xStateListItem ) ); \
+		}																								\
+	}
+
+#else
+
+	#define taskGET_OWNER_OF_READY_ENTRY( pxTCB, uxPriority )	listGET_OWNER_OF_NEXT_ENTRY( ( pxTCB ), &( pxReadyTasksLists[ ( uxPriority ) ] ) )
+	#define taskINSERT_INTO_READY_LIST( pxTCB )					vListInsertEnd( &( pxReadyTasksLists[ ( pxTCB )->uxPriority ] ), &( ( pxTCB )->xStateListItem ) )
+
+#endif /* configUSE_TIMED_EDF */
+
+#if( ( INCLUDE_xTaskCreateTimed == 1 ) && ( configUSE_TIMED_BUDGET_WARNING == 1 ) )
+
+	#define taskTIMED_WARNING_THRESHOLD( xOverrunTicksMax ) ( ( TickType_t ) ( ( ( uint64_t ) ( xOverrunTicksMax ) * ( uint64_t ) configTIMED_BUDGET_WARNING_PERCENT ) / ( uint64_t ) 100U ) )
+
+	/* Budget is checked first at the warning threshold, then at its end */
+	#define taskTIMED_NEXT_BUDGET_CHECK( pxTCB, xUsed )														\
+		( ( ( ( pxTCB )->ucIsWarned == pdFALSE ) && ( ( xUsed ) < ( pxTCB )->xOverrunTicksWarning ) ) ?		\
+		  ( pxTCB )->xOverrunTicksWarning : ( pxTCB )->xOverrunTicksMax )
+
+#else
+
+	#define taskTIMED_NEXT_BUDGET_CHECK( pxTCB, xUsed ) ( ( pxTCB )->xOverrunTicksMax )
+
+#endif /* configUSE_TIMED_BUDGET_WARNING */
+
+/* Priority of a timed task when it holds no inherited priority. Demotions
+change it like vTaskPrioritySet() does, so disinheritance returns to it. */
+#if( configUSE_MUTEXES == 1 )
+	#define taskTIMED_BASE_PRIORITY( pxTCB ) ( ( pxTCB )->uxBasePriority )
+#else
+	#define taskTIMED_BASE_PRIORITY( pxTCB ) ( ( pxTCB )->uxPriority )
+#endif
+
+/*-----------------------------------------------------------*/
+
 #if ( configUSE_PORT_OPTIMISED_TASK_SELECTION == 0 )
 
 	/* If configUSE_PORT_OPTIMISED_TASK_SELECTION is 0 then task selection is
@@ -160,7 +235,7 @@ configIDLE_TASK_NAME in FreeRTOSConfig.h. */
 																										\
 		/* listGET_OWNER_OF_NEXT_ENTRY indexes through the list, so the tasks of						\
 		the	same priority get an equal share of the processor time. */									\
-		listGET_OWNER_OF_NEXT_ENTRY( pxCurrentTCB, &( pxReadyTasksLists[ uxTopPriority ] ) );			\
+		taskGET_OWNER_OF_READY_ENTRY( pxCurrentTCB, uxTopPriority );									\
 		uxTopReadyPriority = uxTopPriority;                                                             \
 	} /* taskSELECT_HIGHEST_PRIORITY_TASK */
 
@@ -190,7 +265,7 @@ configIDLE_TASK_NAME in FreeRTOSConfig.h. */
 		/* Find the highest priority list that contains ready tasks. */								\
 		portGET_HIGHEST_PRIORITY( uxTopPriority, uxTopReadyPriority );								\
 		configASSERT( listCURRENT_LIST_LENGTH( &( pxReadyTasksLists[ uxTopPriority ] ) ) > 0 );		\
-		listGET_OWNER_OF_NEXT_ENTRY( pxCurrentTCB, &( pxReadyTasksLists[ uxTopPriority ] ) );		\
+		taskGET_OWNER_OF_READY_ENTRY( pxCurrentTCB, uxTopPriority );								\
 	} /* taskSELECT_HIGHEST_PRIORITY_TASK() */
 
 	/*-----------------------------------------------------------*/
@@ -230,12 +305,13 @@ count overflows. */
 
 /*
  * Place the task represented by pxTCB into the appropriate ready list for
- * the task.  It is inserted at the end of the list.
+ * the task.  It is inserted at the end of the list, or in order of deadline
+ * at configTIMED_EDF_PRIORITY.
  */
 #define prvAddTaskToReadyList( pxTCB )																\
 	traceMOVED_TASK_TO_READY_STATE( pxTCB );														\
 	taskRECORD_READY_PRIORITY( ( pxTCB )->uxPriority );												\
-	vListInsertEnd( &( pxReadyTasksLists[ ( pxTCB )->uxPriority ] ), &( ( pxTCB )->xStateListItem ) ); \
+	taskINSERT_INTO_READY_LIST( pxTCB );															\
 	tracePOST_MOVED_TASK_TO_READY_STATE( pxTCB )
 /*-----------------------------------------------------------*/
 
@@ -339,18 +415,64 @@ typedef struct tskTaskControlBlock
 	eTaskType eType; /*< TCB can be defined as default, timed and replicated depending on redundancy chosen. */
 
     #if ( INCLUDE_xTaskCreateTimed == 1 )
-        TimerHandle_t xOverflowTimer;   /*< Timer used for tracking the worst time of execution asynchronously. */
-        TimerHandle_t xOverrunTimer;    /*< Timer only running while task is running. */
-        TickType_t    xOverrunTicks;    /*< Number of ticks task was running. */
-        TickType_t    xOverrunTicksMax; /*< Maximum number of ticks task can run until xOverrunTimer's callback is called.  */
+        TimerHandle_t xOverflowTimer;   /*< Timer of 1 tick that forwards an overflow to the timer daemon. Started only when the overflow happens. */
+        TimerHandle_t xOverrunTimer;    /*< Timer of 1 tick that forwards an overrun to the timer daemon. Started only when the overrun happens. */
+        TickType_t    xOverrunTicks;    /*< Number of ticks task was running. Run time counts up to the last switch in if configTIMED_BUDGET_IN_RUN_TIME_COUNTS is 1. */
+        TickType_t    xOverrunTicksMax; /*< Maximum number of ticks (or run time counts) task can run until xOverrunTimer's callback is called.  */
+        ListItem_t    xOverflowListItem;  /*< Item in xOverflowTrackedTasks. Not in any list until the task runs for the first time. */
+        TickType_t    xOverflowStartTick; /*< Tick of the last reset of the task. */
+        TickType_t    xOverflowTicksMax;  /*< Number of ticks after the last reset until xOverflowTimer's callback is called. */
+        ListItem_t    xReplenishListItem; /*< Item in xReplenishTimedTasks while a replenishment is pending. Value is the tick of the replenishment. */
+        TickType_t    xReplenishPeriod;   /*< Ticks between replenishments of the budget, see xTaskTimedSetEnforcement(). */
+        UBaseType_t   uxThrottledPriority;/*< Priority to restore when a demoted task is replenished. */
+        TickType_t    xPeriod;            /*< Release period, 0 if the task isn't periodic. */
+        TickType_t    xReleaseTick;       /*< Tick the current job was due to be released. */
+        uint8_t       ucEnforcement;      /*< eTimedEnforcement of the task. */
+        uint8_t       ucIsThrottled;      /*< pdTRUE from the overrun until the replenishment. */
+        uint8_t       ucJobState;         /*< One of tskJOB_... */
+
+        #if( configUSE_TIMED_BUDGET_WARNING == 1 )
+            TickType_t  xOverrunTicksWarning; /*< Running time at which the warning of the budget is raised. */
+            uint32_t    ulBudgetWarnings;     /*< See ulTaskTimedGetBudgetWarnings(). */
+            uint8_t     ucIsWarned;           /*< pdTRUE from the warning until the overrun time restarts. */
+        #endif
+
+        #if( configUSE_TIMED_CRITICALITY == 1 )
+            ListItem_t  xCriticalityListItem; /*< Item in xCriticalityTimedTasks once the criticality of the task is set. */
+            TickType_t  xOverrunTicksMaxLo;   /*< Overrun time in LO mode, the one the task was created with. */
+            TickType_t  xOverrunTicksMaxHi;   /*< Overrun time of a HI task in HI mode. */
+            UBaseType_t uxModePriority;       /*< Priority to restore when a LO task demoted in HI mode is restored. */
+            uint8_t     ucCriticality;        /*< eTimedCriticality of the task. */
+            uint8_t     ucIsModeDemoted;      /*< pdTRUE while a LO task is demoted by HI mode. */
+        #endif
+
+        #if( configUSE_TIMED_TASK_STATS == 1 )
+            volatile uint32_t ulStatsSequence; /*< Odd while the statistics are written, so readers can retry. */
+            uint32_t ulJobStartRunTime;        /*< Run time counter of the task at the start of the current job. */
+            uint32_t ulStatsJobs;              /*< See TimedStats_t. */
+            uint32_t ulStatsMin;
+            uint32_t ulStatsMax;
+            uint32_t ulStatsWcet;
+            uint64_t ullStatsTotal;            /*< Sum of all jobs, used for the mean. */
+            uint32_t ulStatsBuckets[ configTIMED_TASK_STATS_BUCKETS ];
+            uint32_t ulReleaseRunTime;         /*< Run time counter at the release of the current job of a periodic task. */
+            uint32_t ulJobLatency;             /*< Start latency of the current job, added to the statistics when it ends. */
+            uint32_t ulStatsDeadlineMisses;
+            uint32_t ulStatsJitterMax;
+            uint32_t ulStatsLatencyMax;
+            uint32_t ulStatsResponseMax;
+            uint64_t ullStatsLatencyTotal;
+            uint64_t ullStatsResponseTotal;
+        #endif
     #endif
 
     #if ( INCLUDE_xTaskCreateReplicated == 1 )
-        uint8_t ucIsWaitingOnCompare; /*< Boolean value used to signalize task it is waiting for comparison of tasks */
-        TaskHandle_t pxNextTaskHandle; /*< When using replicated tasks points to next task in replicated group, 1->2->3->1... */
+        struct tskReplicatedGroup *pxReplicatedGroup; /*< Descriptor shared by all tasks in the replicated group. NULL if task is not replicated. */
         CompareValue_t xCompareValue; /*< Value to compare with other tasks. */
         RedundantValueErrorCb_t pxRedundantValueErrorCb; /*< Callback that is used when redundant task's values don't match. */
-        uint8_t ucReplicatedTaskType; /*< Defines number of redundant tasks. Valid 2 or 3. */
+        uint8_t ucReplicaIndex; /*< Position of the task in the replicated group. Also the bit used in the group's arrival mask. */
+        CompareValue_t xCheckpoints[ configMAX_REPLICATED_CHECKPOINTS ]; /*< Values recorded with xTaskRecordCompareValue() since the last synchronization point. */
+        UBaseType_t uxCheckpoints; /*< Number of recorded checkpoints. */
     #endif
 } tskTCB;
 
@@ -358,6 +480,66 @@ typedef struct tskTaskControlBlock
 below to enable the use of older kernel aware debuggers. */
 typedef tskTCB TCB_t;
 
+#if ( INCLUDE_xTaskCreateReplicated == 1 )
+
+    /*
+     * Descriptor of a replicated group. All replicas point to the same
+     * descriptor. Arrival on the synchronization point is tracked with a
+     * bitmask so finding the last arrived replica does not depend on the number
+     * of replicas in the group. Replicas that are not last wait on the group's
+     * event list, so the last replica can wake all of them in one pass.
+     */
+    typedef struct tskReplicatedGroup
+    {
+        List_t   xSyncWaitList;   /*< Replicas waiting for the last replica to arrive on the synchronization point. */
+        TCB_t    *pxReplicas[ configMAX_REPLICATED_TASKS ]; /*< Tasks in the group, indexed by ucReplicaIndex. */
+        uint32_t ulArrivedMask;   /*< Bit n is set while replica n is waiting on the synchronization point. */
+        uint32_t ulMembersMask;   /*< Bit n is set for every replica in the group. */
+        uint8_t  ucNumOfReplicas; /*< Number of replicas in the group. */
+        uint8_t  ucArrivedCount;  /*< Number of replicas waiting on the synchronization point. */
+        const TCB_t *pxFirstArrived; /*< Replica that arrived first in the current round. */
+        BaseType_t xRoundAgrees;  /*< pdTRUE while all replicas arrived in the current round agree with the first one. */
+        ReplicatedMismatch_t xMismatch; /*< Result of the last comparison. */
+
+        /* Early release, see taskREPLICATED_EARLY_RELEASE. */
+        BaseType_t     xEarlyRelease;  /*< pdTRUE if a majority that agrees is released without waiting for the rest. */
+        uint32_t       ulLateMask;     /*< Bit n is set if replica n hasn't arrived on the round that was released early. */
+        uint32_t       ulRespawnMask;  /*< Bit n is set if replica n is respawned on the next round all replicas arrive on. */
+        uint32_t       ulIdleRespawnMask; /*< Bit n is set if replica n replaced itself and is respawned by the idle task. */
+        CompareValue_t xAgreedValue;   /*< Value of the round that was released early. */
+        uint8_t        ucAgreedVotes;  /*< Number of replicas released early. */
+        CompareValue_t xAgreedCheckpoints[ configMAX_REPLICATED_CHECKPOINTS ]; /*< Checkpoints of the round that was released early. */
+        UBaseType_t    uxAgreedCheckpoints; /*< Number of checkpoints of the round that was released early. */
+
+        uint32_t       ulSyncCount;    /*< Number of synchronization points that were compared or released. */
+
+        /* Pipelined mode, see xTaskCreateReplicatedPipelined(). */
+        UBaseType_t    uxSkew;         /*< Number of synchronization points a replica can be ahead of the voter. 0 in lockstep mode. */
+        CompareValue_t *pxRings;       /*< uxSkew compare values per replica, stored after the group in the same allocation. */
+        uint32_t       ulPushed[ configMAX_REPLICATED_TASKS ]; /*< Number of compare values pushed by each replica. */
+        BaseType_t     xIsVoting;      /*< pdTRUE while a replica compares pushed values. */
+
+        /* Parameters the replicas were created with, used to respawn a
+        diverged replica. */
+        TaskFunction_t pxTaskCode;
+        configSTACK_DEPTH_TYPE usStackDepth;
+        void *pvParameters;
+        UBaseType_t uxPriority;
+
+        void   *pvStates;   /*< State blocks of all replicas in one allocation. NULL until pvTaskGetReplicatedState() is called. */
+        size_t xStateSize;  /*< Size of one state block, rounded up to portBYTE_ALIGNMENT. */
+
+        uint8_t ucStaticallyAllocated; /*< Set to pdTRUE if the group was created with xTaskCreateReplicatedStatic(), so it is not freed. */
+        UBaseType_t uxBlockTasks; /*< Number of replicas in the group's block that weren't cleaned up yet. */
+        BaseType_t xIsDeleted;    /*< pdTRUE once the group is deleted. Block is freed when uxBlockTasks drops to 0. */
+    } ReplicatedGroup_t;
+
+    /* Rounds the size of a part of the group's block up, so every part is
+    aligned. */
+    #define tskREPLICATED_ALIGN( xSize ) ( ( ( size_t ) ( xSize ) + portBYTE_ALIGNMENT_MASK ) & ~( ( size_t ) portBYTE_ALIGNMENT_MASK ) )
+
+#endif
+
 /*lint -save -e956 A manual analysis and inspection has been used to determine
 which static variables must be declared volatile. */
 
@@ -371,6 +553,27 @@ PRIVILEGED_DATA static List_t * volatile pxDelayedTaskList = NULL;					/*< Point
 PRIVILEGED_DATA static List_t * volatile pxOverflowDelayedTaskList = NULL;			/*< Points to the delayed task list currently being used to hold tasks that have overflowed the current tick count. */
 PRIVILEGED_DATA static List_t xPendingReadyList = {0};								/*< Tasks that have been readied while the scheduler was suspended.  They will be moved to the ready list when the scheduler is resumed. */
 
+#if( INCLUDE_xTaskCreateTimed == 1 )
+
+	PRIVILEGED_DATA static List_t xOverflowTrackedTasks = {0};					/*< Timed tasks whose overflow time is tracked by the tick interrupt. */
+	PRIVILEGED_DATA static TickType_t xTicksToOverflowCheck = portMAX_DELAY;	/*< Ticks until the tick interrupt checks xOverflowTrackedTasks. Can be too early, but never too late. */
+	PRIVILEGED_DATA static List_t xReplenishTimedTasks = {0};					/*< Timed tasks with a pending replenishment of the budget. */
+	PRIVILEGED_DATA static TickType_t xTicksToReplenishCheck = portMAX_DELAY;	/*< Ticks until the tick interrupt checks xReplenishTimedTasks. Can be too early, but never too late. */
+
+	#if( configUSE_TIMED_CRITICALITY == 1 )
+		PRIVILEGED_DATA static List_t xCriticalityTimedTasks = {0};					/*< Timed tasks whose criticality is set. */
+		PRIVILEGED_DATA static volatile eTimedCriticality eTimedMode = eTimedCriticalityLo;	/*< Mode of the kernel, see xTaskTimedSetCriticality(). */
+	#endif
+
+	#if( configUSE_TIMED_SUPERVISOR == 1 )
+		PRIVILEGED_DATA static TaskHandle_t xTimedSupervisor = NULL;				/*< Task that receives the overrun and overflow events, NULL if they go to the timer service task. */
+		PRIVILEGED_DATA static TimedEvent_t xTimedEvents[ configTIMED_EVENT_QUEUE_LENGTH ];	/*< Events waiting for the supervisor. */
+		PRIVILEGED_DATA static UBaseType_t uxTimedEventsHead = ( UBaseType_t ) 0U;	/*< Index of the oldest event in xTimedEvents. */
+		PRIVILEGED_DATA static UBaseType_t uxTimedEventsCount = ( UBaseType_t ) 0U;
+	#endif
+
+#endif
+
 #if( INCLUDE_vTaskDelete == 1 )
 
 	PRIVILEGED_DATA static List_t xTasksWaitingTermination = {0};					/*< Tasks that have been deleted - but their memory not yet freed. */
@@ -395,11 +598,6 @@ PRIVILEGED_DATA static volatile BaseType_t xNumOfOverflows 			= ( BaseType_t ) 0
 PRIVILEGED_DATA static UBaseType_t uxTaskNumber 					= ( UBaseType_t ) 0U;
 PRIVILEGED_DATA static volatile TickType_t xNextTaskUnblockTime		= ( TickType_t ) 0U; /* Initialised to portMAX_DELAY before the scheduler starts. */
 PRIVILEGED_DATA static TaskHandle_t xIdleTaskHandle					= NULL;			/*< Holds the handle of the idle task.  The idle task is created automatically when the scheduler is started. */
-/* Context switch function can be called from ISR and usually it is. It is
-called from portable layer without input variables. This global variable
-acts as an flag when calling vTaskSwitchContext from user space. It shall
-be set before accessing vTaskSwitchContext not from ISR. */
-PRIVILEGED_DATA static UBaseType_t xIsSwitchContextFromISR          = pdTRUE;
 /* Context switches are held pending while the scheduler is suspended.  Also,
 interrupts must not manipulate the xStateListItem of a TCB, or any of the
 lists the xStateListItem can be referenced from, if the scheduler is suspended.
@@ -491,6 +689,18 @@ static portTASK_FUNCTION_PROTO( prvIdleTask, pvParameters );
 
 #endif
 
+/*
+ * Removes the task from all the lists and deletes it, or places it in the
+ * termination list if the calling task is removed.  Returns pdTRUE if the
+ * calling task was removed, in which case the caller shall yield once it
+ * leaves the critical section.  Shall be called from a critical section.
+ */
+#if ( INCLUDE_vTaskDelete == 1 )
+
+	static BaseType_t prvRemoveTask( TCB_t *pxTCB ) PRIVILEGED_FUNCTION;
+
+#endif
+
 /*
  * Used only by the idle task.  This checks to see if anything has been placed
  * in the list of tasks waiting to be deleted.  If so the task is cleaned up
@@ -589,6 +799,30 @@ static void prvResetNextTaskUnblockTime( void );
                                             RedundantValueErrorCb_t pxRedundantValueErrorCb ) PRIVILEGED_FUNCTION;
 #endif
 
+/*
+ * Same as prvTaskCreateGeneric(), but uses the memory passed in for the TCB,
+ * the stack and the timers of timed tasks. ucStaticallyAllocated tells who
+ * owns the TCB and stack memory, see tskSTATICALLY_ALLOCATED_STACK_AND_TCB.
+ */
+#if( ( configSUPPORT_STATIC_ALLOCATION == 1 ) || ( INCLUDE_xTaskCreateReplicated == 1 ) )
+    static BaseType_t prvTaskCreateStaticGeneric( TaskFunction_t pxTaskCode,
+                                                  const char * const pcName,     /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+                                                  const uint32_t ulStackDepth,
+                                                  void * const pvParameters,
+                                                  UBaseType_t uxPriority,
+                                                  TaskHandle_t * const pxCreatedTask,
+                                                  StackType_t * const puxStackBuffer,
+                                                  StaticTask_t * const pxTaskBuffer,
+                                                  uint8_t ucStaticallyAllocated,
+                                                  eTaskType eType,
+                                                  TickType_t xOverrunTime,
+                                                  WorstTimeTimerCb_t pxOverrunTimerCb,
+                                                  StaticTimer_t * const pxOverrunTimerBuffer,
+                                                  TickType_t xOverflowTime,
+                                                  WorstTimeTimerCb_t pxOverflowTimerCb,
+                                                  StaticTimer_t * const pxOverflowTimerBuffer,
+                                                  RedundantValueErrorCb_t pxRedundantValueErrorCb ) PRIVILEGED_FUNCTION;
+#endif
 
 /*
  * Called after a Task_t structure has been allocated either statically or
@@ -605,10 +839,25 @@ static void prvInitialiseNewTask(   TaskFunction_t pxTaskCode,
                                     eTaskType eType,
                                     TickType_t xOverrunTime,
                                     WorstTimeTimerCb_t pxOverrunTimerCb,
+                                    StaticTimer_t * const pxOverrunTimerBuffer,
                                     TickType_t xOverflowTime,
                                     WorstTimeTimerCb_t pxOverflowTimerCb,
+                                    StaticTimer_t * const pxOverflowTimerBuffer,
                                     RedundantValueErrorCb_t pxRedundantValueErrorCb ) PRIVILEGED_FUNCTION;
 
+#if( INCLUDE_xTaskCreateTimed == 1 )
+    /*
+     * Creates a timer of a timed task. Memory of the timer is pxTimerBuffer,
+     * or allocated if pxTimerBuffer is NULL.
+     */
+    static TimerHandle_t prvCreateTimedTaskTimer( const char * const pcTimerName,
+                                                  const TickType_t xTimerPeriodInTicks,
+                                                  const UBaseType_t uxAutoReload,
+                                                  TCB_t * const pxTCB,
+                                                  WorstTimeTimerCb_t pxCallbackFunction,
+                                                  StaticTimer_t * const pxTimerBuffer ) PRIVILEGED_FUNCTION;
+#endif
+
 /*
  * Called after a new task has been created and initialised to place the task
  * under the control of the scheduler.
@@ -616,89 +865,312 @@ static void prvInitialiseNewTask(   TaskFunction_t pxTaskCode,
 static void prvAddNewTaskToReadyList( TCB_t *pxNewTCB ) PRIVILEGED_FUNCTION;
 #if( INCLUDE_xTaskCreateTimed == 1 )
     /*
-     * Increments the overrun tick of the current TCB.
-     * pdTRUE will be returned if timer callback should be called, pdFALSE
+     * Called from the tick interrupt. Counts the running time of the current
+     * task and checks the overflow time of the tracked timed tasks. Only an
+     * overrun or overflow that happened is forwarded to the timer daemon.
+     * pdTRUE will be returned if a context switch is required, pdFALSE
+     * otherwise.
+     */
+    static BaseType_t prvCheckTimedTasks( const TickType_t xConstTickCount );
+
+    /*
+     * (Re)starts tracking the overflow time of the task from the current tick.
+     * Must be called from a critical section.
+     */
+    static void prvStartOverflowTracking( TCB_t * const pxTCB );
+
+    /*
+     * Forwards the overrun or overflow of the task. The event is posted to
+     * the supervisor, if there is one. Otherwise, or if no more events fit,
+     * the timer of 1 tick is started as if it was started a tick ago, so the
+     * timer daemon calls its callback as soon as it processes the command.
+     * Must be called from a critical section or the tick interrupt.
+     */
+    static void prvForwardTimedEvent( TCB_t * const pxTCB, TimerHandle_t xTimer, BaseType_t * const pxSwitchRequired );
+
+    /*
+     * Restarts the overrun time of the task. Must be called from a critical
+     * section or the tick interrupt.
+     */
+    static void prvRestartOverrunTime( TCB_t * const pxTCB );
+
+    /*
+     * Applies the enforcement of the running task, whose budget ran out. The
+     * overrun is forwarded only on the first call before the replenishment.
+     * pdTRUE will be returned if a context switch is required, pdFALSE
+     * otherwise.
+     */
+    static BaseType_t prvThrottleTimedTask( TCB_t * const pxTCB );
+
+    /*
+     * Restarts the budget of the task and undoes its throttling.
+     * pdTRUE will be returned if a context switch is required, pdFALSE
      * otherwise.
      */
-    static BaseType_t prvIncrementOverrunTick(void);
+    static BaseType_t prvReplenishTimedTask( TCB_t * const pxTCB );
+
+    /*
+     * Schedules the replenishment of the task's budget xTicks from now.
+     */
+    static void prvScheduleReplenishment( TCB_t * const pxTCB, const TickType_t xTicks );
+
+    /*
+     * Changes the running priority of the task and moves it to its new ready
+     * list, if it is ready.
+     */
+    static void prvSetTimedPriority( TCB_t * const pxTCB, const UBaseType_t uxNewPriority );
+
+    /*
+     * Releases the next job of the periodic task. Must be called from a
+     * critical section or the tick interrupt.
+     */
+    static void prvReleaseTimedJob( TCB_t * const pxTCB );
+
+    /*
+     * Ends the current job of the periodic task. Must be called from a
+     * critical section.
+     */
+    static void prvCompleteTimedJob( TCB_t * const pxTCB );
 #endif
 
-#if( INCLUDE_xTaskCreateReplicated == 1 )
+#if( ( INCLUDE_xTaskCreateTimed == 1 ) && ( configUSE_TIMED_EDF == 1 ) )
+    /*
+     * Returns the absolute deadline of the task, the tick its overflow time
+     * runs out. Tasks without an overflow time never reach a deadline and
+     * portMAX_DELAY is returned, so they are scheduled after all timed tasks.
+     */
+    static TickType_t prvGetTimedDeadline( const TCB_t * const pxTCB );
+
+    /*
+     * Inserts the item into the ready list of configTIMED_EDF_PRIORITY after
+     * all items whose deadline isn't later. Deadlines are compared by their
+     * difference, so the order survives the wrap of the tick count.
+     */
+    static void prvInsertTimedReadyList( ListItem_t * const pxNewListItem );
+
+    /*
+     * Returns the task with the earliest deadline at configTIMED_EDF_PRIORITY.
+     * If the running task is at the head, it goes behind the tasks with the
+     * same deadline first.
+     */
+    static TCB_t * prvSelectTimedReadyTask( void );
+
+    /*
+     * Moves a ready task of configTIMED_EDF_PRIORITY to the position of its
+     * new deadline. Returns pdTRUE if the running task of that priority no
+     * longer has the earliest deadline. Must be called from a critical
+     * section.
+     */
+    static BaseType_t prvResortTimedReadyTask( TCB_t * const pxTCB );
+#endif
+
+#if( ( INCLUDE_xTaskCreateTimed == 1 ) && ( configUSE_TIMED_TASK_STATS == 1 ) )
+    /*
+     * Ends the current job of the timed task and adds it to the statistics.
+     * Must be called from a critical section.
+     */
+    static void prvRecordTimedJob( TCB_t * const pxTCB );
+
+    /*
+     * Clears the statistics, except for the WCET. Must be called from a
+     * critical section, or before the task runs.
+     */
+    static void prvClearTimedStats( TCB_t * const pxTCB );
+#endif
+
+#if( ( INCLUDE_xTaskCreateTimed == 1 ) && ( configUSE_TIMED_CRITICALITY == 1 ) )
+    /*
+     * Switches the kernel to eMode and brings all tasks in
+     * xCriticalityTimedTasks to it. Must be called from a critical section or
+     * the tick interrupt, with the scheduler running.
+     * pdTRUE will be returned if a context switch is required, pdFALSE
+     * otherwise.
+     */
+    static BaseType_t prvSetTimedMode( const eTimedCriticality eMode );
+
+    /*
+     * Sets the budget and the priority of the task for the current mode.
+     * pdTRUE will be returned if a context switch is required, pdFALSE
+     * otherwise.
+     */
+    static BaseType_t prvApplyTimedMode( TCB_t * const pxTCB );
+#endif
+
+#if( ( INCLUDE_xTaskCreateTimed == 1 ) && ( configUSE_TIMED_SUPERVISOR == 1 ) )
+    /*
+     * Adds the event to xTimedEvents.
+     * pdPASS will be returned if the event was added, pdFAIL if no more
+     * events fit.
+     */
+    static BaseType_t prvPostTimedEvent( TCB_t * const pxTCB, TimerHandle_t xTimer, const eTimedEvent eEvent );
+#endif
+
+#if( ( INCLUDE_xTaskCreateTimed == 1 ) && ( configUSE_TIMED_BUDGET_WARNING == 1 ) )
+    /*
+     * Raises the warning if the task used xUsed of its budget and it wasn't
+     * raised since the budget restarted. Must be called from a critical
+     * section or the tick interrupt.
+     */
+    static void prvCheckBudgetWarning( TCB_t * const pxTCB, const TickType_t xUsed, BaseType_t * const pxSwitchRequired );
+#endif
+
+#if( ( INCLUDE_xTaskCreateTimed == 1 ) && ( configTIMED_BUDGET_IN_RUN_TIME_COUNTS == 1 ) )
     /*
-     * Sets the handle of next replicated task when using task replication
+     * Checks the overrun budget of the task that has been running for
+     * ulSliceCounts since it was switched in. If the budget ran out the
+     * overrun is forwarded and the budget restarts.
+     * pdTRUE will be returned if a context switch is required, pdFALSE
+     * otherwise.
      */
-    static void prvSetNextReplicatedTask( TaskHandle_t pxTaskHandle,
-        TaskHandle_t const pxNewNextTaskHandle );
+    static BaseType_t prvCheckOverrunBudget( TCB_t * const pxTCB, const uint32_t ulSliceCounts );
 #endif
 
 #if( INCLUDE_xTaskCreateReplicated == 1 )
     /*
-     * Sets the type of replicated task when task replication is used.
+     * Adds the task to the replicated group. Task gets the next index in the
+     * group.
      */
-    static void prvSetReplicatedTaskType( TaskHandle_t pxTaskHandle,
-        const uint8_t ucNewReplicatedTaskType );
+    static void prvAddReplicaToGroup( ReplicatedGroup_t * const pxGroup,
+                                      TaskHandle_t const pxTaskHandle );
 #endif
 
 #if( INCLUDE_xTaskCreateReplicated == 1 )
-    static void prvUnblockReplicatedTasks( TCB_t * pxStartTCB );
+    /*
+     * Moves all replicas waiting on the group's synchronization point to the
+     * ready list. Context switch is requested at most once.
+     */
+    static void prvUnblockReplicatedTasks( ReplicatedGroup_t * const pxGroup );
 #endif
 
 #if( INCLUDE_xTaskCreateReplicated == 1 )
     /*
-     * Fills the xCompareValues buffer with compare values from replicated tasks
+     * Fills the xCompareValues buffer with compare values from replicated
+     * tasks. Values are ordered by replica index.
      */
-    static void prvGetCompareValues( TCB_t * pxTCB,
+    static void prvGetCompareValues( const ReplicatedGroup_t * const pxGroup,
                                      CompareValue_t * xCompareValues,
-                                     uint8_t ucValuesLen );
+                                     UBaseType_t uxCheckpoint );
+
+    /*
+     * Returns pdTRUE if both replicas have the same compare value and
+     * checkpoints. Cost doesn't depend on the number of replicas.
+     */
+    static BaseType_t prvReplicasAgree( const TCB_t * const pxTCB, const TCB_t * const pxOtherTCB );
 #endif
 
 #if( INCLUDE_xTaskCreateReplicated == 1 )
+
+    /* Results of prvMarkReplicaArrived(). */
+    #define replicatedWAIT          ( ( BaseType_t ) 0 ) /*< Replica waits for others. */
+    #define replicatedLAST          ( ( BaseType_t ) 1 ) /*< Every replica arrived. */
+    #define replicatedEARLY         ( ( BaseType_t ) 2 ) /*< Arrived replicas agree and are a majority. */
+    #define replicatedLATE          ( ( BaseType_t ) 3 ) /*< Replica arrived on a round that was already released. */
+
     /*
-     * Check is all replicated tasks have the same compare value. Return value
-     * is pdTRUE or pdFALSE.
+     * Marks the calling replica as arrived on the synchronization point and
+     * returns one of the results above. The arrival mask is cleared for the
+     * next round when the round is released. Shall be called from a critical
+     * section.
      */
-    static uint8_t prvIsCompareValueSame( TCB_t * pxTCB );
+    static BaseType_t prvMarkReplicaArrived( TCB_t * pxTCB );
 #endif
 
 #if( INCLUDE_xTaskCreateReplicated == 1 )
     /*
-     * Checks if all replicated tasks except calling task are waiting on the
-     * synchronization blockade. Return value is pdTRUE or pdFALSE.
+     * Compares the values of all replicas when every replica arrived on the
+     * synchronization point, handles the callback's request and releases the
+     * waiting replicas.
      */
-    static uint8_t prvIsLastArrivedRedundantTask( TCB_t * pxTCB );
+    static void prvCompareAllReplicas( TCB_t * pxTCB, ReplicatedGroup_t * pxGroup );
 #endif
 
-#if( INCLUDE_xTaskCreateTimed == 1 )
+#if( INCLUDE_xTaskCreateReplicated == 1 )
     /*
-     * Pauses the overrun timer of the current TCB. If current TCB is not timed
-     * task or it doesn't have a overrun timer it does nothing and returns pdFAIL.
+     * Compares the value of a replica that arrived after its round was
+     * released early with the value that was agreed on.
      */
-    static BaseType_t prvPauseOverrunTimer( TCB_t * pxTCB, UBaseType_t xIsFromISR );
+    static void prvCompareLateReplica( TCB_t * pxTCB, ReplicatedGroup_t * pxGroup );
 #endif
 
-#if( INCLUDE_xTaskCreateTimed == 1 )
+#if( INCLUDE_xTaskCreateReplicated == 1 )
+    /*
+     * Votes on the compare values and records which replicas diverged from
+     * the voted value in the group's mismatch info.
+     */
+    static void prvRecordMismatch( ReplicatedGroup_t * const pxGroup,
+                                   const CompareValue_t * const pxCompareValues,
+                                   uint32_t ulSyncIndex,
+                                   UBaseType_t uxCheckpoint );
+#endif
 
+#if( INCLUDE_xTaskCreateReplicated == 1 )
     /*
-     * pdFALSE will be returned if the timer is dormant.  A value other than
-     * pdFALSE will be returned if the timer is active.
+     * Called when a replica that lives in the block of a dynamically
+     * allocated group is cleaned up. Frees the block, which starts with the
+     * group, with the last such replica of a deleted group.
      */
-    static BaseType_t prvIsOverrunTimerActive( TCB_t * pxTCB, UBaseType_t xIsFromISR );
+    static void prvReleaseGroupBlock( ReplicatedGroup_t * const pxGroup ) PRIVILEGED_FUNCTION;
+#endif
 
+#if( INCLUDE_xTaskCreateReplicated == 1 )
+    /*
+     * Returns checkpoint uxCheckpoint of the replica. Values recorded with
+     * xTaskRecordCompareValue() are followed by the value of
+     * vTaskSyncAndCompare(), which also stands in for checkpoints the replica
+     * didn't record.
+     */
+    static CompareValue_t prvGetCheckpoint( const TCB_t * const pxTCB, UBaseType_t uxCheckpoint );
 #endif
 
-#if INCLUDE_xTaskCreateTimed == 1
+#if( INCLUDE_xTaskCreateReplicated == 1 )
+    /*
+     * Common part of xTaskCreateReplicated(), xTaskCreateReplicatedPipelined()
+     * and xTaskCreateReplicatedStatic(). uxSkew is 0 for lockstep groups.
+     * Memory is allocated if pxGroupBuffer is NULL.
+     */
+    static BaseType_t prvCreateReplicatedGroup( TaskFunction_t pxTaskCode,
+                                                const char * const pcName,
+                                                const uint32_t ulStackDepth,
+                                                void * const pvParameters,
+                                                UBaseType_t uxPriority,
+                                                TaskHandle_t * const pxCreatedTask,
+                                                uint8_t ucReplicatedType,
+                                                UBaseType_t uxSkew,
+                                                StackType_t * const puxStackBuffers,
+                                                StaticTask_t * const pxTaskBuffers,
+                                                StaticReplicatedGroup_t * const pxGroupBuffer,
+                                                RedundantValueErrorCb_t pxRedundantValueErrorCb );
+#endif
 
+#if( INCLUDE_xTaskCreateReplicated == 1 )
     /*
-     * Starts the overflow timer. If task doesn't have a timer than pdFALSE is returned.
+     * vTaskSyncAndCompare() of pipelined groups. Pushes the compare value into
+     * the replica's ring, blocking only while the ring is full, and compares
+     * the rounds every replica pushed.
      */
-    static BaseType_t prvStartOverflowTimer( TCB_t * pxTCB, UBaseType_t xIsFromISR, BaseType_t * pxHigherPriorityTaskWoken );
+    static void prvSyncPipelined( TCB_t * pxTCB,
+                                  ReplicatedGroup_t * pxGroup,
+                                  CompareValue_t xCompareValue );
+#endif
 
+#if( INCLUDE_xTaskCreateReplicated == 1 )
     /*
-     * Resumes the overrun timer. If task doesn't have a timer than pdFALSE is returned.
+     * Replaces every diverged replica with a new task and copies the state
+     * block of a majority replica into the diverged replica's state block.
+     * Returns pdFAIL if no majority exists or a task couldn't be created.
+     * pxIsDeletingSelf is set to pdTRUE if the calling task was replaced.
      */
-    static BaseType_t prvResumeOverrunTimer( TCB_t * pxTCB, UBaseType_t xIsFromISR, BaseType_t * pxHigherPriorityTaskWoken );
+    static BaseType_t prvRespawnDivergedReplicas( ReplicatedGroup_t * const pxGroup,
+                                                  BaseType_t * const pxIsDeletingSelf );
 
+    /*
+     * Creates the replica again in its own TCB and stack, which are no longer
+     * used by the replaced task. Shall be called with the scheduler suspended.
+     */
+    static void prvRespawnReplica( ReplicatedGroup_t * const pxGroup,
+                                   TCB_t * const pxTCB );
 #endif
+
 /*
  * freertos_tasks_c_additions_init() should only be called if the user definable
  * macro FREERTOS_TASKS_C_ADDITIONS_INIT() is defined, as that is the only macro
@@ -722,8 +1194,54 @@ static void prvAddNewTaskToReadyList( TCB_t *pxNewTCB ) PRIVILEGED_FUNCTION;
 									StackType_t * const puxStackBuffer,
 									StaticTask_t * const pxTaskBuffer )
 	{
+	TaskHandle_t xReturn = NULL;
+
+		( void ) prvTaskCreateStaticGeneric( pxTaskCode,
+		                                     pcName,
+		                                     ulStackDepth,
+		                                     pvParameters,
+		                                     uxPriority,
+		                                     &xReturn,
+		                                     puxStackBuffer,
+		                                     pxTaskBuffer,
+		                                     tskSTATICALLY_ALLOCATED_STACK_AND_TCB,
+		                                     eDefault,
+		                                     0,
+		                                     NULL,
+		                                     NULL,
+		                                     0,
+		                                     NULL,
+		                                     NULL,
+		                                     NULL );
+
+		return xReturn;
+	}
+
+#endif /* SUPPORT_STATIC_ALLOCATION */
+/*-----------------------------------------------------------*/
+
+#if( ( configSUPPORT_STATIC_ALLOCATION == 1 ) || ( INCLUDE_xTaskCreateReplicated == 1 ) )
+
+	static BaseType_t prvTaskCreateStaticGeneric( TaskFunction_t pxTaskCode,
+	                                              const char * const pcName,		/*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+	                                              const uint32_t ulStackDepth,
+	                                              void * const pvParameters,
+	                                              UBaseType_t uxPriority,
+	                                              TaskHandle_t * const pxCreatedTask,
+	                                              StackType_t * const puxStackBuffer,
+	                                              StaticTask_t * const pxTaskBuffer,
+	                                              uint8_t ucStaticallyAllocated,
+	                                              eTaskType eType,
+	                                              TickType_t xOverrunTime,
+	                                              WorstTimeTimerCb_t pxOverrunTimerCb,
+	                                              StaticTimer_t * const pxOverrunTimerBuffer,
+	                                              TickType_t xOverflowTime,
+	                                              WorstTimeTimerCb_t pxOverflowTimerCb,
+	                                              StaticTimer_t * const pxOverflowTimerBuffer,
+	                                              RedundantValueErrorCb_t pxRedundantValueErrorCb )
+	{
 	TCB_t *pxNewTCB;
-	TaskHandle_t xReturn;
+	BaseType_t xReturn;
 
 		configASSERT( puxStackBuffer != NULL );
 		configASSERT( pxTaskBuffer != NULL );
@@ -748,9 +1266,13 @@ static void prvAddNewTaskToReadyList( TCB_t *pxNewTCB ) PRIVILEGED_FUNCTION;
 
 			#if( tskSTATIC_AND_DYNAMIC_ALLOCATION_POSSIBLE != 0 ) /*lint !e731 Macro has been consolidated for readability reasons. */
 			{
-				/* Tasks can be created statically or dynamically, so note this
-				task was created statically in case the task is later deleted. */
-				pxNewTCB->ucStaticallyAllocated = tskSTATICALLY_ALLOCATED_STACK_AND_TCB;
+				/* Tasks can be created statically or dynamically, so note how
+				this task was created in case the task is later deleted. */
+				pxNewTCB->ucStaticallyAllocated = ucStaticallyAllocated;
+			}
+			#else
+			{
+				( void ) ucStaticallyAllocated;
 			}
 			#endif /* configSUPPORT_DYNAMIC_ALLOCATION */
 
@@ -759,26 +1281,29 @@ static void prvAddNewTaskToReadyList( TCB_t *pxNewTCB ) PRIVILEGED_FUNCTION;
 			                      ulStackDepth,
 			                      pvParameters,
 			                      uxPriority,
-			                      &xReturn,
+			                      pxCreatedTask,
 			                      pxNewTCB,
 			                      NULL,
-			                      eDefault,
-			                      0,
-			                      NULL,
-                                  0,
-                                  NULL,
-			                      NULL );
+			                      eType,
+			                      xOverrunTime,
+			                      pxOverrunTimerCb,
+			                      pxOverrunTimerBuffer,
+			                      xOverflowTime,
+			                      pxOverflowTimerCb,
+			                      pxOverflowTimerBuffer,
+			                      pxRedundantValueErrorCb );
 			prvAddNewTaskToReadyList( pxNewTCB );
+			xReturn = pdPASS;
 		}
 		else
 		{
-			xReturn = NULL;
+			xReturn = errCOULD_NOT_ALLOCATE_REQUIRED_MEMORY;
 		}
 
 		return xReturn;
 	}
 
-#endif /* SUPPORT_STATIC_ALLOCATION */
+#endif /* ( configSUPPORT_STATIC_ALLOCATION == 1 ) || ( INCLUDE_xTaskCreateReplicated == 1 ) */
 /*-----------------------------------------------------------*/
 
 #if( ( portUSING_MPU_WRAPPERS == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) )
@@ -993,8 +1518,10 @@ static void prvAddNewTaskToReadyList( TCB_t *pxNewTCB ) PRIVILEGED_FUNCTION;
 			                      eType,
                                   xOverrunTime,
                                   pxOverrunTimerCb,
+                                  NULL,
                                   xOverflowTime,
                                   pxOverflowTimerCb,
+                                  NULL,
 			                      pxRedundantValueErrorCb );
 			prvAddNewTaskToReadyList( pxNewTCB );
 			xReturn = pdPASS;
@@ -1021,8 +1548,10 @@ static void prvInitialiseNewTask( 	TaskFunction_t pxTaskCode,
 									eTaskType eType,
                                     TickType_t xOverrunTime,
                                     WorstTimeTimerCb_t pxOverrunTimerCb,
+                                    StaticTimer_t * const pxOverrunTimerBuffer,
 									TickType_t xOverflowTime,
 									WorstTimeTimerCb_t pxOverflowTimerCb,
+									StaticTimer_t * const pxOverflowTimerBuffer,
 									RedundantValueErrorCb_t pxRedundantValueErrorCb )
 {
 StackType_t *pxTopOfStack;
@@ -1127,6 +1656,28 @@ UBaseType_t x;
 	vListInitialiseItem( &( pxNewTCB->xStateListItem ) );
 	vListInitialiseItem( &( pxNewTCB->xEventListItem ) );
 
+	#if( INCLUDE_xTaskCreateTimed == 1 )
+	{
+		vListInitialiseItem( &( pxNewTCB->xOverflowListItem ) );
+		listSET_LIST_ITEM_OWNER( &( pxNewTCB->xOverflowListItem ), pxNewTCB );
+		vListInitialiseItem( &( pxNewTCB->xReplenishListItem ) );
+		listSET_LIST_ITEM_OWNER( &( pxNewTCB->xReplenishListItem ), pxNewTCB );
+
+		/* Checked by the tick for every unblocked task */
+		pxNewTCB->xPeriod = 0;
+		pxNewTCB->ucJobState = tskJOB_STARTED;
+
+		#if( configUSE_TIMED_CRITICALITY == 1 )
+		{
+			vListInitialiseItem( &( pxNewTCB->xCriticalityListItem ) );
+			listSET_LIST_ITEM_OWNER( &( pxNewTCB->xCriticalityListItem ), pxNewTCB );
+			pxNewTCB->ucCriticality = ( uint8_t ) eTimedCriticalityLo;
+			pxNewTCB->ucIsModeDemoted = pdFALSE;
+		}
+		#endif /* configUSE_TIMED_CRITICALITY */
+	}
+	#endif /* INCLUDE_xTaskCreateTimed */
+
 	/* Set the pxNewTCB as a link back from the ListItem_t.  This is so we can get
 	back to	the containing TCB from a generic item in a list. */
 	listSET_LIST_ITEM_OWNER( &( pxNewTCB->xStateListItem ), pxNewTCB );
@@ -1215,11 +1766,17 @@ UBaseType_t x;
             if( ( xOverflowTime != 0 ) && ( pxOverflowTimerCb != NULL ) )
             {
                 static char pcOverflowName[] = "OverflowTimer";
-                pxNewTCB->xOverflowTimer = xTimerCreate( pcOverflowName,
-                                                         xOverflowTime,
-                                                         pdTRUE,
-                                                         (void *) pxNewTCB,
-                                                         pxOverflowTimerCb );
+
+                /* Overflow time is tracked by the tick interrupt, timer only
+                forwards the overflow to the daemon. */
+                pxNewTCB->xOverflowTimer = prvCreateTimedTaskTimer( pcOverflowName,
+                                                                    1,
+                                                                    pdFALSE,
+                                                                    pxNewTCB,
+                                                                    pxOverflowTimerCb,
+                                                                    pxOverflowTimerBuffer );
+
+                pxNewTCB->xOverflowTicksMax = xOverflowTime;
 
                 /* If stuck here, timer could not be created. */
                 configASSERT(pxNewTCB->xOverflowTimer);
@@ -1233,14 +1790,21 @@ UBaseType_t x;
             {
                 static char pcOverrunName[] = "OverrunTimer";
 
-                pxNewTCB->xOverrunTimer = xTimerCreate( pcOverrunName,
-                                                        1,
-                                                        pdFALSE,
-                                                        (void *) pxNewTCB,
-                                                        pxOverrunTimerCb );
+                pxNewTCB->xOverrunTimer = prvCreateTimedTaskTimer( pcOverrunName,
+                                                                   1,
+                                                                   pdFALSE,
+                                                                   pxNewTCB,
+                                                                   pxOverrunTimerCb,
+                                                                   pxOverrunTimerBuffer );
 
                 pxNewTCB->xOverrunTicksMax = xOverrunTime;
 
+                #if( configUSE_TIMED_BUDGET_WARNING == 1 )
+                {
+                    pxNewTCB->xOverrunTicksWarning = taskTIMED_WARNING_THRESHOLD( xOverrunTime );
+                }
+                #endif
+
                 /* If stuck here, timer could not be created. */
                 configASSERT( pxNewTCB->xOverrunTimer );
                 configASSERT( xOverrunTime > 0 );
@@ -1250,19 +1814,51 @@ UBaseType_t x;
                 pxNewTCB->xOverrunTimer = NULL;
             }
 
+            pxNewTCB->xOverrunTicks = 0;
+
+            #if( configUSE_TIMED_BUDGET_WARNING == 1 )
+            {
+                pxNewTCB->ulBudgetWarnings = 0;
+                pxNewTCB->ucIsWarned = pdFALSE;
+            }
+            #endif
+
+            /* Callback only until xTaskTimedSetEnforcement() is called */
+            pxNewTCB->ucEnforcement = ( uint8_t ) eTimedEnforceNone;
+            pxNewTCB->ucIsThrottled = pdFALSE;
+            pxNewTCB->xReplenishPeriod = 0;
+            pxNewTCB->uxThrottledPriority = pxNewTCB->uxPriority;
+
+            #if( configUSE_TIMED_TASK_STATS == 1 )
+            {
+                /* First job starts when the task runs for the first time */
+                pxNewTCB->ulStatsSequence = 0;
+                pxNewTCB->ulJobStartRunTime = 0;
+                pxNewTCB->ulStatsWcet = 0;
+                pxNewTCB->ulReleaseRunTime = 0;
+                pxNewTCB->ulJobLatency = 0;
+                prvClearTimedStats( pxNewTCB );
+            }
+            #endif
+
             /* Set unused handle values to default value. */
-            pxNewTCB->ucIsWaitingOnCompare = pdFALSE;
-            pxNewTCB->pxNextTaskHandle = NULL;
+            pxNewTCB->pxReplicatedGroup = NULL;
             pxNewTCB->xCompareValue = 0;
             pxNewTCB->pxRedundantValueErrorCb = NULL;
-            pxNewTCB->ucReplicatedTaskType = pdFALSE;
+            pxNewTCB->ucReplicaIndex = 0;
+            pxNewTCB->uxCheckpoints = 0;
 	    }
 	    break;
 
 	    case eReplicated:
 	    {
-	        pxNewTCB->ucIsWaitingOnCompare = pdFALSE;
+	        /* Group is assigned by xTaskCreateReplicated after the task is
+	        created. */
+	        pxNewTCB->pxReplicatedGroup = NULL;
+	        pxNewTCB->xCompareValue = 0;
 	        pxNewTCB->pxRedundantValueErrorCb = pxRedundantValueErrorCb;
+	        pxNewTCB->ucReplicaIndex = 0;
+	        pxNewTCB->uxCheckpoints = 0;
 
             /* Set unused handle values to default value. */
             pxNewTCB->xOverflowTimer = NULL;
@@ -1277,11 +1873,11 @@ UBaseType_t x;
             pxNewTCB->xOverflowTimer = NULL;
             pxNewTCB->xOverrunTimer  = NULL;
 
-            pxNewTCB->ucIsWaitingOnCompare = pdFALSE;
-            pxNewTCB->pxNextTaskHandle = NULL;
+            pxNewTCB->pxReplicatedGroup = NULL;
             pxNewTCB->xCompareValue = 0;
             pxNewTCB->pxRedundantValueErrorCb = NULL;
-            pxNewTCB->ucReplicatedTaskType = pdFALSE;
+            pxNewTCB->ucReplicaIndex = 0;
+            pxNewTCB->uxCheckpoints = 0;
         }
         break;
 	}
@@ -1389,101 +1985,77 @@ static void prvAddNewTaskToReadyList( TCB_t *pxNewTCB )
 	void vTaskDelete( TaskHandle_t xTaskToDelete )
 	{
 	TCB_t *pxTCB;
-    TCB_t *pxStartingTCB;
-    TCB_t *pxNextTCB = NULL;
+	BaseType_t xIsDeletingSelf = pdFALSE;
+    #if( INCLUDE_xTaskCreateReplicated == 1 )
+        ReplicatedGroup_t *pxGroup;
+    #endif
 
 		taskENTER_CRITICAL();
 		{
 			/* If null is passed in here then it is the calling task that is
 			being deleted. */
 			pxTCB = prvGetTCBFromHandle( xTaskToDelete );
-			pxStartingTCB = pxTCB;
-
-			do{
-                /* Remove task from the ready list. */
-                if( uxListRemove( &( pxTCB->xStateListItem ) ) == ( UBaseType_t ) 0 )
-                {
-                    taskRESET_READY_PRIORITY( pxTCB->uxPriority );
-                }
-                else
-                {
-                    mtCOVERAGE_TEST_MARKER();
-                }
-
-                /* Is the task waiting on an event also? */
-                if( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) != NULL )
-                {
-                    ( void ) uxListRemove( &( pxTCB->xEventListItem ) );
-                }
-                else
-                {
-                    mtCOVERAGE_TEST_MARKER();
-                }
 
-                /* Increment the uxTaskNumber also so kernel aware debuggers can
-                detect that the task lists need re-generating.  This is done before
-                portPRE_TASK_DELETE_HOOK() as in the Windows port that macro will
-                not return. */
-                uxTaskNumber++;
-
-                /* Delete the timer for tracing the worst time of the task
-                if it is being used */
-                if( pxTCB->xOverflowTimer != NULL )
-                {
-                    xTimerDelete( pxTCB->xOverflowTimer, portMAX_DELAY );
-                }
-
-                /* Delete the timer for tracing the worst runtime of the task
-                if it is being used */
-                if( pxTCB->xOverrunTimer != NULL )
-                {
-                    xTimerDelete( pxTCB->xOverrunTimer, portMAX_DELAY );
-                }
-                /* Get next TCB for when when using task replication */
-                if( NULL != pxTCB->pxNextTaskHandle )
-                {
-                    pxNextTCB = prvGetTCBFromHandle( pxTCB->pxNextTaskHandle );
-                }
+            #if( INCLUDE_xTaskCreateReplicated == 1 )
+            {
+                /* Deleting one replica deletes the whole replicated group. */
+                pxGroup = pxTCB->pxReplicatedGroup;
 
-                if( pxTCB == pxCurrentTCB )
+                if( pxGroup != NULL )
                 {
-                    /* A task is deleting itself.  This cannot complete within the
-                    task itself, as a context switch to another task is required.
-                    Place the task in the termination list.  The idle task will
-                    check the termination list and free up any memory allocated by
-                    the scheduler for the TCB and stack of the deleted task. */
-                    vListInsertEnd( &xTasksWaitingTermination, &( pxTCB->xStateListItem ) );
-
-                    /* Increment the ucTasksDeleted variable so the idle task knows
-                    there is a task that has been deleted and that it should therefore
-                    check the xTasksWaitingTermination list. */
-                    ++uxDeletedTasksWaitingCleanUp;
-
-                    /* The pre-delete hook is primarily for the Windows simulator,
-                    in which Windows specific clean up operations are performed,
-                    after which it is not possible to yield away from this task -
-                    hence xYieldPending is used to latch that a context switch is
-                    required. */
-                    portPRE_TASK_DELETE_HOOK( pxTCB, &xYieldPending );
+                    for( uint8_t iii = 0; iii < pxGroup->ucNumOfReplicas; iii++ )
+                    {
+                        pxTCB = pxGroup->pxReplicas[ iii ];
+
+                        /* Replicas in the group's block keep the group, they
+                         * release it when they are cleaned up */
+                        if( pxTCB->ucStaticallyAllocated != tskGROUP_ALLOCATED_STACK_AND_TCB )
+                        {
+                            pxTCB->pxReplicatedGroup = NULL;
+                        }
+
+                        if( ( pxGroup->ulIdleRespawnMask & ( ( ( uint32_t ) 1UL ) << iii ) ) != 0 )
+                        {
+                            /* Replica already waits for the idle task, which
+                             * now cleans it up instead of respawning it */
+                            continue;
+                        }
+
+                        if( prvRemoveTask( pxTCB ) != pdFALSE )
+                        {
+                            xIsDeletingSelf = pdTRUE;
+                        }
+                    }
+
+                    pxGroup->ulIdleRespawnMask = 0;
+
+                    /* No replica uses the group anymore. */
+                    vPortFree( pxGroup->pvStates );
+                    pxGroup->pvStates = NULL;
+
+                    if( pxGroup->ucStaticallyAllocated == pdFALSE )
+                    {
+                        /* Block is freed now, or by the idle task after the
+                         * calling replica, which runs on a stack in the
+                         * block, is cleaned up */
+                        pxGroup->xIsDeleted = pdTRUE;
+
+                        if( pxGroup->uxBlockTasks == ( UBaseType_t ) 0U )
+                        {
+                            vPortFree( pxGroup );
+                        }
+                    }
                 }
                 else
                 {
-                    --uxCurrentNumberOfTasks;
-                    prvDeleteTCB( pxTCB );
-
-                    /* Reset the next expected unblock time in case it referred to
-                    the task that has just been deleted. */
-                    prvResetNextTaskUnblockTime();
-                }
-
-                traceTASK_DELETE( pxTCB );
-
-                if( NULL != pxNextTCB )
-                {
-                    pxTCB = pxNextTCB;
+                    xIsDeletingSelf = prvRemoveTask( pxTCB );
                 }
-			} while( eReplicated == pxTCB->eType &&
-			         pxTCB != pxStartingTCB );
+            }
+            #else
+            {
+                xIsDeletingSelf = prvRemoveTask( pxTCB );
+            }
+            #endif
 		}
 		taskEXIT_CRITICAL();
 
@@ -1491,7 +2063,7 @@ static void prvAddNewTaskToReadyList( TCB_t *pxNewTCB )
 		been deleted. */
 		if( xSchedulerRunning != pdFALSE )
 		{
-			if( pxTCB == pxCurrentTCB )
+			if( xIsDeletingSelf != pdFALSE )
 			{
 				configASSERT( uxSchedulerSuspended == 0 );
 				portYIELD_WITHIN_API();
@@ -1502,24 +2074,127 @@ static void prvAddNewTaskToReadyList( TCB_t *pxNewTCB )
 			}
 		}
 	}
-
-#endif /* INCLUDE_vTaskDelete */
 /*-----------------------------------------------------------*/
 
-#if ( INCLUDE_vTaskDelayUntil == 1 )
-
-	void vTaskDelayUntil( TickType_t * const pxPreviousWakeTime, const TickType_t xTimeIncrement )
+	static BaseType_t prvRemoveTask( TCB_t *pxTCB )
 	{
-	TickType_t xTimeToWake;
-	BaseType_t xAlreadyYielded, xShouldDelay = pdFALSE;
-
-		configASSERT( pxPreviousWakeTime );
-		configASSERT( ( xTimeIncrement > 0U ) );
-		configASSERT( uxSchedulerSuspended == 0 );
+	BaseType_t xIsDeletingSelf = pdFALSE;
 
-		vTaskSuspendAll();
+		/* Remove task from the ready list. */
+		if( uxListRemove( &( pxTCB->xStateListItem ) ) == ( UBaseType_t ) 0 )
 		{
-			/* Minor optimisation.  The tick count cannot change in this
+			taskRESET_READY_PRIORITY( pxTCB->uxPriority );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		/* Is the task waiting on an event also? */
+		if( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) != NULL )
+		{
+			( void ) uxListRemove( &( pxTCB->xEventListItem ) );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		/* Increment the uxTaskNumber also so kernel aware debuggers can
+		detect that the task lists need re-generating.  This is done before
+		portPRE_TASK_DELETE_HOOK() as in the Windows port that macro will
+		not return. */
+		uxTaskNumber++;
+
+        /* Stop tracking the overflow time and the budget of the task */
+        if( listLIST_ITEM_CONTAINER( &( pxTCB->xOverflowListItem ) ) != NULL )
+        {
+            ( void ) uxListRemove( &( pxTCB->xOverflowListItem ) );
+        }
+
+        if( listLIST_ITEM_CONTAINER( &( pxTCB->xReplenishListItem ) ) != NULL )
+        {
+            ( void ) uxListRemove( &( pxTCB->xReplenishListItem ) );
+        }
+
+        #if( configUSE_TIMED_CRITICALITY == 1 )
+        {
+            if( listLIST_ITEM_CONTAINER( &( pxTCB->xCriticalityListItem ) ) != NULL )
+            {
+                ( void ) uxListRemove( &( pxTCB->xCriticalityListItem ) );
+            }
+        }
+        #endif /* configUSE_TIMED_CRITICALITY */
+
+        /* Delete the timer for tracing the worst time of the task
+        if it is being used */
+        if( pxTCB->xOverflowTimer != NULL )
+        {
+            xTimerDelete( pxTCB->xOverflowTimer, portMAX_DELAY );
+        }
+
+        /* Delete the timer for tracing the worst runtime of the task
+        if it is being used */
+        if( pxTCB->xOverrunTimer != NULL )
+        {
+            xTimerDelete( pxTCB->xOverrunTimer, portMAX_DELAY );
+        }
+
+		if( pxTCB == pxCurrentTCB )
+		{
+			/* A task is deleting itself.  This cannot complete within the
+			task itself, as a context switch to another task is required.
+			Place the task in the termination list.  The idle task will
+			check the termination list and free up any memory allocated by
+			the scheduler for the TCB and stack of the deleted task. */
+			vListInsertEnd( &xTasksWaitingTermination, &( pxTCB->xStateListItem ) );
+
+			/* Increment the ucTasksDeleted variable so the idle task knows
+			there is a task that has been deleted and that it should therefore
+			check the xTasksWaitingTermination list. */
+			++uxDeletedTasksWaitingCleanUp;
+
+			/* The pre-delete hook is primarily for the Windows simulator,
+			in which Windows specific clean up operations are performed,
+			after which it is not possible to yield away from this task -
+			hence xYieldPending is used to latch that a context switch is
+			required. */
+			portPRE_TASK_DELETE_HOOK( pxTCB, &xYieldPending );
+
+			xIsDeletingSelf = pdTRUE;
+		}
+		else
+		{
+			--uxCurrentNumberOfTasks;
+			prvDeleteTCB( pxTCB );
+
+			/* Reset the next expected unblock time in case it referred to
+			the task that has just been deleted. */
+			prvResetNextTaskUnblockTime();
+		}
+
+		traceTASK_DELETE( pxTCB );
+
+		return xIsDeletingSelf;
+	}
+
+#endif /* INCLUDE_vTaskDelete */
+/*-----------------------------------------------------------*/
+
+#if ( INCLUDE_vTaskDelayUntil == 1 )
+
+	void vTaskDelayUntil( TickType_t * const pxPreviousWakeTime, const TickType_t xTimeIncrement )
+	{
+	TickType_t xTimeToWake;
+	BaseType_t xAlreadyYielded, xShouldDelay = pdFALSE;
+
+		configASSERT( pxPreviousWakeTime );
+		configASSERT( ( xTimeIncrement > 0U ) );
+		configASSERT( uxSchedulerSuspended == 0 );
+
+		vTaskSuspendAll();
+		{
+			/* Minor optimisation.  The tick count cannot change in this
 			block. */
 			const TickType_t xConstTickCount = xTickCount;
 
@@ -2020,7 +2695,6 @@ static void prvAddNewTaskToReadyList( TCB_t *pxNewTCB )
 				}
 				else
 				{
-				    xIsSwitchContextFromISR = pdFALSE;
 					vTaskSwitchContext();
 				}
 			}
@@ -2979,6 +3653,17 @@ BaseType_t xSwitchRequired = pdFALSE;
 						mtCOVERAGE_TEST_MARKER();
 					}
 
+					#if( INCLUDE_xTaskCreateTimed == 1 )
+					{
+						/* Periodic task waiting for its release. Before it
+						is ready, so the deadline is known. */
+						if( pxTCB->ucJobState == tskJOB_WAITING )
+						{
+							prvReleaseTimedJob( pxTCB );
+						}
+					}
+					#endif /* INCLUDE_xTaskCreateTimed */
+
 					/* Place the unblocked task into the appropriate ready
 					list. */
 					prvAddTaskToReadyList( pxTCB );
@@ -3021,6 +3706,19 @@ BaseType_t xSwitchRequired = pdFALSE;
 		}
 		#endif /* ( ( configUSE_PREEMPTION == 1 ) && ( configUSE_TIME_SLICING == 1 ) ) */
 
+		#if( INCLUDE_xTaskCreateTimed == 1 )
+		{
+			if( prvCheckTimedTasks( xConstTickCount ) != pdFALSE )
+			{
+				xSwitchRequired = pdTRUE;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		#endif /* INCLUDE_xTaskCreateTimed */
+
 		#if ( configUSE_TICK_HOOK == 1 )
 		{
 			/* Guard against the tick hook being called when the pended tick
@@ -3062,14 +3760,6 @@ BaseType_t xSwitchRequired = pdFALSE;
 	}
 	#endif /* configUSE_PREEMPTION */
 
-
-#if INCLUDE_xTaskCreateTimed == 1
-	if( prvIncrementOverrunTick() == pdTRUE )
-	{
-	    xSwitchRequired = pdTRUE;
-	}
-#endif
-
 	return xSwitchRequired;
 }
 /*-----------------------------------------------------------*/
@@ -3203,24 +3893,23 @@ void vTaskSwitchContext( void )
 				{
 					mtCOVERAGE_TEST_MARKER();
 				}
+
+				#if( ( INCLUDE_xTaskCreateTimed == 1 ) && ( configTIMED_BUDGET_IN_RUN_TIME_COUNTS == 1 ) )
+				{
+					/* Charge the time of the slice to the overrun budget. */
+					if( pxCurrentTCB->xOverrunTimer != NULL )
+					{
+						configTIMED_BUDGET_DISARM();
+						pxCurrentTCB->xOverrunTicks += ( ulTotalRunTime - ulTaskSwitchedInTime );
+						( void ) prvCheckOverrunBudget( pxCurrentTCB, 0UL );
+					}
+				}
+				#endif /* configTIMED_BUDGET_IN_RUN_TIME_COUNTS */
+
 				ulTaskSwitchedInTime = ulTotalRunTime;
 		}
 		#endif /* configGENERATE_RUN_TIME_STATS */
 
-        #if( INCLUDE_xTaskCreateTimed == 1 )
-        {
-            if( pxCurrentTCB->xOverrunTimer != NULL )
-            {
-                if(pxCurrentTCB->xOverrunTicks >= ( pxCurrentTCB->xOverrunTicksMax - 1 ) )
-                {
-                    /* Starts the timer with the period of 1. */
-                    xTimerResetFromISR( pxCurrentTCB->xOverrunTimer, NULL );
-                    pxCurrentTCB->xOverrunTicks = 0;
-                }
-            }
-        }
-        #endif /* INCLUDE_xTaskCreateTimed == 1 */
-
         /* Check for stack overflow, if configured. */
         taskCHECK_FOR_STACK_OVERFLOW();
 
@@ -3231,17 +3920,52 @@ void vTaskSwitchContext( void )
 
         #if( INCLUDE_xTaskCreateTimed == 1 )
         {
-            BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+            /* Overflow time is tracked from the first time the task runs.
+            Budgets are counted by the tick interrupt, so nothing else is
+            needed on a context switch. */
+            if( ( pxCurrentTCB->xOverflowTimer != NULL ) &&
+                ( listLIST_ITEM_CONTAINER( &( pxCurrentTCB->xOverflowListItem ) ) == NULL ) )
+            {
+                prvStartOverflowTracking( pxCurrentTCB );
+            }
 
-            prvStartOverflowTimer( pxCurrentTCB, xIsSwitchContextFromISR, &xHigherPriorityTaskWoken );
+            /* First run of a released job */
+            if( pxCurrentTCB->ucJobState == tskJOB_RELEASED )
+            {
+                #if( configUSE_TIMED_TASK_STATS == 1 )
+                {
+                    pxCurrentTCB->ulJobLatency = ulTaskSwitchedInTime - pxCurrentTCB->ulReleaseRunTime;
+                }
+                #endif
+
+                pxCurrentTCB->ucJobState = tskJOB_STARTED;
+            }
+
+            /* Sporadic budget is replenished a period after its first use */
+            if( ( pxCurrentTCB->xOverrunTimer != NULL ) &&
+                ( pxCurrentTCB->ucEnforcement == ( uint8_t ) eTimedEnforceSporadic ) &&
+                ( listLIST_ITEM_CONTAINER( &( pxCurrentTCB->xReplenishListItem ) ) == NULL ) )
+            {
+                prvScheduleReplenishment( pxCurrentTCB, pxCurrentTCB->xReplenishPeriod );
+            }
 
-            if(xHigherPriorityTaskWoken != pdFALSE)
+            #if( configTIMED_BUDGET_IN_RUN_TIME_COUNTS == 1 )
             {
-                /* Select a new task to run using either the generic C or port
-                optimised asm code.
-                Highest priority should be the timer daemon. */
-                taskSELECT_HIGHEST_PRIORITY_TASK();
+                /* Rest of the budget expires within the slice. A suspended
+                task woken before its replenishment is delayed again. */
+                if( pxCurrentTCB->xOverrunTimer != NULL )
+                {
+                    if( pxCurrentTCB->ucIsThrottled == pdFALSE )
+                    {
+                        configTIMED_BUDGET_ARM( taskTIMED_NEXT_BUDGET_CHECK( pxCurrentTCB, pxCurrentTCB->xOverrunTicks ) - pxCurrentTCB->xOverrunTicks );
+                    }
+                    else if( pxCurrentTCB->ucEnforcement == ( uint8_t ) eTimedEnforceSuspend )
+                    {
+                        configTIMED_BUDGET_ARM( 0U );
+                    }
+                }
             }
+            #endif /* configTIMED_BUDGET_IN_RUN_TIME_COUNTS */
         }
         #endif /* INCLUDE_xTaskCreateTimed == 1 */
 
@@ -3254,8 +3978,6 @@ void vTaskSwitchContext( void )
 			_impure_ptr = &( pxCurrentTCB->xNewLib_reent );
 		}
 		#endif /* configUSE_NEWLIB_REENTRANT */
-
-		xIsSwitchContextFromISR = pdTRUE;
 	}
 }
 /*-----------------------------------------------------------*/
@@ -3593,6 +4315,36 @@ static portTASK_FUNCTION( prvIdleTask, pvParameters )
 		is responsible for freeing the deleted task's TCB and stack. */
 		prvCheckTasksWaitingTermination();
 
+		#if( ( INCLUDE_xTaskCreateTimed == 1 ) && ( configUSE_TIMED_CRITICALITY == 1 ) )
+		{
+			/* Idle task runs only when no HI task is ready, so the LO tasks
+			don't have to be held back any more. */
+			if( eTimedMode != eTimedCriticalityLo )
+			{
+			BaseType_t xYieldRequired;
+
+				taskENTER_CRITICAL();
+				{
+					xYieldRequired = prvSetTimedMode( eTimedCriticalityLo );
+				}
+				taskEXIT_CRITICAL();
+
+				if( xYieldRequired != pdFALSE )
+				{
+					taskYIELD();
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		#endif /* configUSE_TIMED_CRITICALITY */
+
 		#if ( configUSE_PREEMPTION == 0 )
 		{
 			/* If we are not using preemption we keep forcing a task switch to
@@ -3799,6 +4551,19 @@ UBaseType_t uxPriority;
 	vListInitialise( &xDelayedTaskList2 );
 	vListInitialise( &xPendingReadyList );
 
+	#if( INCLUDE_xTaskCreateTimed == 1 )
+	{
+		vListInitialise( &xOverflowTrackedTasks );
+		vListInitialise( &xReplenishTimedTasks );
+
+		#if( configUSE_TIMED_CRITICALITY == 1 )
+		{
+			vListInitialise( &xCriticalityTimedTasks );
+		}
+		#endif /* configUSE_TIMED_CRITICALITY */
+	}
+	#endif /* INCLUDE_xTaskCreateTimed */
+
 	#if ( INCLUDE_vTaskDelete == 1 )
 	{
 		vListInitialise( &xTasksWaitingTermination );
@@ -3840,7 +4605,36 @@ static void prvCheckTasksWaitingTermination( void )
 			}
 			taskEXIT_CRITICAL();
 
-			prvDeleteTCB( pxTCB );
+			#if( INCLUDE_xTaskCreateReplicated == 1 )
+			{
+			ReplicatedGroup_t *pxGroup;
+			uint32_t ulSlot;
+
+				/* A replica that replaced itself is respawned in its TCB and
+				stack. Scheduler is suspended, so the group can't be deleted
+				meanwhile. */
+				vTaskSuspendAll();
+				{
+					pxGroup = pxTCB->pxReplicatedGroup;
+					ulSlot = ( ( uint32_t ) 1UL ) << pxTCB->ucReplicaIndex;
+
+					if( ( pxTCB->eType == eReplicated ) && ( pxGroup != NULL ) && ( ( pxGroup->ulIdleRespawnMask & ulSlot ) != 0 ) )
+					{
+						pxGroup->ulIdleRespawnMask &= ~ulSlot;
+						prvRespawnReplica( pxGroup, pxTCB );
+					}
+					else
+					{
+						prvDeleteTCB( pxTCB );
+					}
+				}
+				( void ) xTaskResumeAll();
+			}
+			#else
+			{
+				prvDeleteTCB( pxTCB );
+			}
+			#endif /* INCLUDE_xTaskCreateReplicated */
 		}
 	}
 	#endif /* INCLUDE_vTaskDelete */
@@ -4041,7 +4835,7 @@ static void prvCheckTasksWaitingTermination( void )
 		}
 		#endif /* configUSE_NEWLIB_REENTRANT */
 
-		#if( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 0 ) && ( portUSING_MPU_WRAPPERS == 0 ) )
+		#if( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( tskSTATIC_AND_DYNAMIC_ALLOCATION_POSSIBLE == 0 ) && ( portUSING_MPU_WRAPPERS == 0 ) )
 		{
 			/* The task can only have been allocated dynamically - free both
 			the stack and TCB. */
@@ -4066,6 +4860,14 @@ static void prvCheckTasksWaitingTermination( void )
 				only memory that must be freed. */
 				vPortFree( pxTCB );
 			}
+			#if( INCLUDE_xTaskCreateReplicated == 1 )
+			else if( pxTCB->ucStaticallyAllocated == tskGROUP_ALLOCATED_STACK_AND_TCB )
+			{
+				/* Stack and TCB are in the block of the replicated group, it
+				is freed with the last of them. */
+				prvReleaseGroupBlock( pxTCB->pxReplicatedGroup );
+			}
+			#endif
 			else
 			{
 				/* Neither the stack nor the TCB were allocated dynamically, so
@@ -5378,7 +6180,7 @@ const TickType_t xConstTickCount = xTickCount;
 /* Code below is added as a modification for tracking worst time of execution
 of a task */
 
-#if( INCLUDE_xTaskCreateTimed == 1 )
+#if( ( INCLUDE_xTaskCreateTimed == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
 
     BaseType_t xTaskCreateTimed( TaskFunction_t pxTaskCode,
                             const char * const pcName,
@@ -5408,256 +6210,2255 @@ of a task */
 
 /*-----------------------------------------------------------*/
 
-void vTaskTimedReset( TaskHandle_t pxTaskHandle )
-{
-    TCB_t * pxTaskToTimeReset = prvGetTCBFromHandle( pxTaskHandle );
-
-    configASSERT( pxTaskToTimeReset->eType == eTimed );
-
-    if( pxTaskToTimeReset->xOverflowTimer != NULL )
-    {
-        /* Could be potential problem with waiting indefinitely.
-           If program is stuck here increase the size of timer
-           input queue or if pausing of overrun timer is not
-           priority lower the delay. */
-        xTimerReset( pxTaskToTimeReset->xOverflowTimer, portMAX_DELAY );
-    }
+#if( ( INCLUDE_xTaskCreateTimed == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) )
 
-    if( pxTaskToTimeReset->xOverrunTimer != NULL )
+    TaskHandle_t xTaskCreateTimedStatic( TaskFunction_t pxTaskCode,
+                            const char * const pcName,
+                            const uint32_t ulStackDepth,
+                            void * const pvParameters,
+                            UBaseType_t uxPriority,
+                            StackType_t * const puxStackBuffer,
+                            StaticTask_t * const pxTaskBuffer,
+                            TickType_t xOverrunTime,
+                            WorstTimeTimerCb_t pxOverrunTimerCb,
+                            StaticTimer_t * const pxOverrunTimerBuffer,
+                            TickType_t xOverflowTime,
+                            WorstTimeTimerCb_t pxOverflowTimerCb,
+                            StaticTimer_t * const pxOverflowTimerBuffer )
     {
-        pxTaskToTimeReset->xOverrunTicks = 0;
-    }
-}
-
-/*-----------------------------------------------------------*/
+        TaskHandle_t xReturn = NULL;
+
+        /* Timers that are used need memory as well */
+        configASSERT( ( pxOverrunTimerCb == NULL ) || ( pxOverrunTimerBuffer != NULL ) );
+        configASSERT( ( pxOverflowTimerCb == NULL ) || ( pxOverflowTimerBuffer != NULL ) );
+
+        ( void ) prvTaskCreateStaticGeneric( pxTaskCode,
+                                             pcName,
+                                             ulStackDepth,
+                                             pvParameters,
+                                             uxPriority,
+                                             &xReturn,
+                                             puxStackBuffer,
+                                             pxTaskBuffer,
+                                             tskSTATICALLY_ALLOCATED_STACK_AND_TCB,
+                                             eTimed,
+                                             xOverrunTime,
+                                             pxOverrunTimerCb,
+                                             pxOverrunTimerBuffer,
+                                             xOverflowTime,
+                                             pxOverflowTimerCb,
+                                             pxOverflowTimerBuffer,
+                                             NULL );
 
-#if INCLUDE_xTaskCreateTimed == 1
-    BaseType_t prvIncrementOverrunTick(void)
-    {
-        BaseType_t xReturn = pdFALSE;
-        if( pxCurrentTCB->xOverrunTimer != NULL )
-        {
-            pxCurrentTCB->xOverrunTicks++;
-            if(pxCurrentTCB->xOverrunTicks >= ( pxCurrentTCB->xOverrunTicksMax - 1 ) )
-            {
-                xReturn = pdTRUE;
-            }
-        }
         return xReturn;
     }
 #endif
 
 /*-----------------------------------------------------------*/
 
-eTaskType eTaskGetType( TaskHandle_t pxTaskHandle )
-{
-    TCB_t * pxTCB = prvGetTCBFromHandle( pxTaskHandle );
-    configASSERT( pxTCB );
-    return pxTCB->eType;
-}
-
-/*-----------------------------------------------------------*/
-
-#if( INCLUDE_xTaskCreateReplicated == 1 )
-
-    BaseType_t xTaskCreateReplicated( TaskFunction_t pxTaskCode,
-                            const char * const pcName,
-                            const configSTACK_DEPTH_TYPE usStackDepth,
-                            void * const pvParameters,
-                            UBaseType_t uxPriority,
-                            TaskHandle_t * const pxCreatedTask,
-                            uint8_t ucReplicatedType,
-                            RedundantValueErrorCb_t pxRedundantValueErrorCb )
+#if( ( INCLUDE_xTaskCreateTimed == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+    BaseType_t xTaskCreateTimedPeriodic( TaskFunction_t pxTaskCode,
+                                         const char * const pcName,
+                                         const configSTACK_DEPTH_TYPE usStackDepth,
+                                         void * const pvParameters,
+                                         UBaseType_t uxPriority,
+                                         TaskHandle_t * const pxCreatedTask,
+                                         TickType_t xPeriod,
+                                         TickType_t xOverrunTime,
+                                         WorstTimeTimerCb_t pxOverrunTimerCb,
+                                         TickType_t xDeadline,
+                                         WorstTimeTimerCb_t pxDeadlineMissCb )
     {
+        TaskHandle_t xHandle = NULL;
         BaseType_t xReturn;
-        TaskHandle_t pxInternalTaskHandle1 = NULL;
-        TaskHandle_t pxInternalTaskHandle2 = NULL;
-
-        configASSERT( ( ucReplicatedType == taskREPLICATED_NO_RECOVERY ) || ( ucReplicatedType == taskREPLICATED_RECOVERY ) );
-        configASSERT( pxRedundantValueErrorCb );
 
-        /* Make sure all tasks are created before tasks are switched into */
-        taskENTER_CRITICAL();
+        configASSERT( xPeriod > ( TickType_t ) 0 );
+        configASSERT( xDeadline <= xPeriod );
 
-        xReturn = prvTaskCreateGeneric( pxTaskCode,
-                                        pcName,
-                                        usStackDepth,
-                                        pvParameters,
-                                        uxPriority,
-                                        &pxInternalTaskHandle1,
-                                        eReplicated,
-                                        0,
-                                        NULL,
-                                        0,
-                                        NULL,
-                                        pxRedundantValueErrorCb );
-
-        if( pdPASS != xReturn )
-        {
-            /* First task creation failed */
-            return xReturn;
-        }
-
-       xReturn = prvTaskCreateGeneric( pxTaskCode,
-                                       pcName,
-                                       usStackDepth,
-                                       pvParameters,
-                                       uxPriority,
-                                       &pxInternalTaskHandle2,
-                                       eReplicated,
-                                       0,
-                                       NULL,
-                                       0,
-                                       NULL,
-                                       pxRedundantValueErrorCb );
-
-       if( pdPASS != xReturn )
-       {
-           /* Second task creation failed, delete first created task */
-           vTaskDelete(pxInternalTaskHandle1);
-
-           return xReturn;
-       }
-
-       /* Link the second task to the first one */
-       prvSetNextReplicatedTask( pxInternalTaskHandle1, pxInternalTaskHandle2 );
-
-       prvSetReplicatedTaskType( pxInternalTaskHandle1, ucReplicatedType );
-       prvSetReplicatedTaskType( pxInternalTaskHandle2, ucReplicatedType );
-
-        if( taskREPLICATED_RECOVERY == ucReplicatedType )
-        {
-            TaskHandle_t pxInternalTaskHandle3 = NULL;
-
-            /* Make third identical tasks */
+        /* First job is released before the task can run. Allocation is
+        done with the scheduler suspended, not in a critical section. */
+        vTaskSuspendAll();
+        {
             xReturn = prvTaskCreateGeneric( pxTaskCode,
                                             pcName,
                                             usStackDepth,
                                             pvParameters,
                                             uxPriority,
-                                            &pxInternalTaskHandle3,
-                                            eReplicated,
-                                            0,
-                                            NULL,
-                                            0,
-                                            NULL,
-                                            pxRedundantValueErrorCb );
-            if( pdPASS != xReturn )
+                                            &xHandle,
+                                            eTimed,
+                                            xOverrunTime,
+                                            pxOverrunTimerCb,
+                                            xDeadline,
+                                            pxDeadlineMissCb,
+                                            NULL );
+
+            if( xReturn == pdPASS )
             {
-                /* Third task creation failed, delete other tasks */
-                vTaskDelete( pxInternalTaskHandle1 );
-                vTaskDelete( pxInternalTaskHandle2 );
+                TCB_t * const pxTCB = ( TCB_t * ) xHandle;
 
-                return xReturn;
+                taskENTER_CRITICAL();
+                {
+                    pxTCB->xPeriod = xPeriod;
+                    pxTCB->xReleaseTick = xTickCount;
+                    prvReleaseTimedJob( pxTCB );
+                }
+                taskEXIT_CRITICAL();
             }
-
-            prvSetReplicatedTaskType( pxInternalTaskHandle3, ucReplicatedType );
-
-            /* Link the tasks */
-            prvSetNextReplicatedTask( pxInternalTaskHandle2, pxInternalTaskHandle3 );
-            prvSetNextReplicatedTask( pxInternalTaskHandle3, pxInternalTaskHandle1 );
         }
-        else
-        {
-            /* We only need two tasks */
-            prvSetNextReplicatedTask( pxInternalTaskHandle2, pxInternalTaskHandle1 );
-        }
-
+        ( void ) xTaskResumeAll();
 
         if( pxCreatedTask != NULL )
         {
-            /* If task handle to return is NULL we don't have to fill it,
-             * but as it isn't NULL we fill it with one of the created tasks */
-            *pxCreatedTask  = pxInternalTaskHandle1;
+            *pxCreatedTask = xHandle;
         }
 
-        taskEXIT_CRITICAL();
-
         return xReturn;
     }
 #endif
 
 /*-----------------------------------------------------------*/
 
-#if( INCLUDE_xTaskCreateReplicated == 1 )
-    static void prvSetNextReplicatedTask( TaskHandle_t pxTaskHandle,
-            TaskHandle_t const pxNewNextTaskHandle )
-    {
-        TCB_t * pxTCB = prvGetTCBFromHandle( pxTaskHandle );
-        configASSERT( pxTCB );
-        configASSERT( pxNewNextTaskHandle );
+#if( INCLUDE_xTaskCreateTimed == 1 )
 
-        pxTCB->pxNextTaskHandle = pxNewNextTaskHandle;
-    }
-#endif
+    static TimerHandle_t prvCreateTimedTaskTimer( const char * const pcTimerName,
+                                                  const TickType_t xTimerPeriodInTicks,
+                                                  const UBaseType_t uxAutoReload,
+                                                  TCB_t * const pxTCB,
+                                                  WorstTimeTimerCb_t pxCallbackFunction,
+                                                  StaticTimer_t * const pxTimerBuffer )
+    {
+        TimerHandle_t xTimer = NULL;
 
-/*-----------------------------------------------------------*/
+        if( pxTimerBuffer != NULL )
+        {
+            #if( configSUPPORT_STATIC_ALLOCATION == 1 )
+            {
+                xTimer = xTimerCreateStatic( pcTimerName,
+                                             xTimerPeriodInTicks,
+                                             uxAutoReload,
+                                             ( void * ) pxTCB,
+                                             pxCallbackFunction,
+                                             pxTimerBuffer );
+            }
+            #endif
+        }
+        else
+        {
+            #if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+            {
+                xTimer = xTimerCreate( pcTimerName,
+                                       xTimerPeriodInTicks,
+                                       uxAutoReload,
+                                       ( void * ) pxTCB,
+                                       pxCallbackFunction );
+            }
+            #endif
+        }
 
-#if( INCLUDE_xTaskCreateReplicated == 1 )
-    static void prvSetReplicatedTaskType( TaskHandle_t pxTaskHandle,
-            const uint8_t ucNewReplicatedTaskType )
-    {
-        TCB_t * pxTCB = prvGetTCBFromHandle( pxTaskHandle );
-        configASSERT( pxTCB );
+        #if( configTIMER_SERVICE_LANES > 1 )
+        {
+            /* Overrun and overflow callbacks are not delayed by the timers of
+             * the application. */
+            if( xTimer != NULL )
+            {
+                vTimerSetLane( xTimer, ( UBaseType_t ) configTIMER_KERNEL_LANE );
+            }
+        }
+        #endif
 
-        pxTCB->ucReplicatedTaskType = ucNewReplicatedTaskType;
+        return xTimer;
     }
 #endif
 
 /*-----------------------------------------------------------*/
 
-#if( INCLUDE_xTaskCreateReplicated == 1 )
-    void vTaskSyncAndCompare( const CompareValue_t * const pxNewCompareValue )
-    {
-        TCB_t * pxTCB = prvGetTCBFromHandle( NULL );
-
-        configASSERT( pxTCB );
+void vTaskTimedReset( TaskHandle_t pxTaskHandle )
+{
+    TCB_t * pxTaskToTimeReset = prvGetTCBFromHandle( pxTaskHandle );
+
+    configASSERT( pxTaskToTimeReset->eType == eTimed );
+
+    if( pxTaskToTimeReset->xOverflowTimer != NULL )
+    {
+        /* Only the tracked tick is updated, timer daemon isn't involved */
+        taskENTER_CRITICAL();
+        {
+            prvStartOverflowTracking( pxTaskToTimeReset );
+
+            #if( configUSE_TIMED_EDF == 1 )
+            {
+                /* New deadline is later, so another ready task can be at the
+                head of the EDF list now. */
+                if( prvResortTimedReadyTask( pxTaskToTimeReset ) != pdFALSE )
+                {
+                    taskYIELD_IF_USING_PREEMPTION();
+                }
+            }
+            #endif /* configUSE_TIMED_EDF */
+        }
+        taskEXIT_CRITICAL();
+    }
+
+    #if( configUSE_TIMED_TASK_STATS == 1 )
+    {
+        taskENTER_CRITICAL();
+        {
+            prvRecordTimedJob( pxTaskToTimeReset );
+        }
+        taskEXIT_CRITICAL();
+    }
+    #endif
+
+    /* Budget of an enforced task is restarted only by its replenishment */
+    if( ( pxTaskToTimeReset->xOverrunTimer != NULL ) &&
+        ( pxTaskToTimeReset->ucEnforcement == ( uint8_t ) eTimedEnforceNone ) )
+    {
+        taskENTER_CRITICAL();
+        {
+            prvRestartOverrunTime( pxTaskToTimeReset );
+        }
+        taskEXIT_CRITICAL();
+    }
+}
+
+/*-----------------------------------------------------------*/
+
+#if( INCLUDE_xTaskCreateTimed == 1 )
+    BaseType_t xTaskTimedSetEnforcement( TaskHandle_t xTask, eTimedEnforcement eEnforcement, TickType_t xReplenishPeriod )
+    {
+        TCB_t * pxTCB = prvGetTCBFromHandle( xTask );
+        BaseType_t xReturn = pdPASS;
+
+        configASSERT( pxTCB->eType == eTimed );
+        configASSERT( pxTCB->xOverrunTimer != NULL );
+
+        if( ( eEnforcement != eTimedEnforceNone ) && ( xReplenishPeriod == ( TickType_t ) 0 ) )
+        {
+            xReturn = pdFAIL;
+        }
+        else
+        {
+            taskENTER_CRITICAL();
+            {
+                /* New enforcement starts with a full budget */
+                if( prvReplenishTimedTask( pxTCB ) != pdFALSE )
+                {
+                    taskYIELD_IF_USING_PREEMPTION();
+                }
+
+                if( listLIST_ITEM_CONTAINER( &( pxTCB->xReplenishListItem ) ) != NULL )
+                {
+                    ( void ) uxListRemove( &( pxTCB->xReplenishListItem ) );
+                }
+
+                pxTCB->ucEnforcement = ( uint8_t ) eEnforcement;
+                pxTCB->xReplenishPeriod = xReplenishPeriod;
+
+                /* Sporadic replenishment is scheduled when the task starts
+                using the budget */
+                if( ( eEnforcement == eTimedEnforceDemote ) || ( eEnforcement == eTimedEnforceSuspend ) )
+                {
+                    prvScheduleReplenishment( pxTCB, xReplenishPeriod );
+                }
+            }
+            taskEXIT_CRITICAL();
+        }
+
+        return xReturn;
+    }
+#endif
+
+/*-----------------------------------------------------------*/
+
+#if( INCLUDE_xTaskCreateTimed == 1 )
+    void vTaskTimedWaitForNextPeriod( void )
+    {
+        TCB_t * const pxTCB = prvGetTCBFromHandle( NULL );
+        TickType_t xTicksToRelease;
+        BaseType_t xAlreadyYielded;
+
+        configASSERT( pxTCB->xPeriod != ( TickType_t ) 0 );
+        configASSERT( uxSchedulerSuspended == 0 );
+
+        /* Tick count can't change until the task is delayed, same as in
+        vTaskDelay() */
+        vTaskSuspendAll();
+        {
+            taskENTER_CRITICAL();
+            {
+                prvCompleteTimedJob( pxTCB );
+
+                pxTCB->xReleaseTick += pxTCB->xPeriod;
+                xTicksToRelease = pxTCB->xReleaseTick - xTickCount;
+
+                /* Late job, the next one was due already and starts now */
+                if( ( xTicksToRelease == ( TickType_t ) 0 ) || ( xTicksToRelease > pxTCB->xPeriod ) )
+                {
+                    xTicksToRelease = 0;
+                    prvReleaseTimedJob( pxTCB );
+                    pxTCB->ucJobState = tskJOB_STARTED;
+
+                    #if( configUSE_TIMED_EDF == 1 )
+                    {
+                        /* Deadline moved to the next job, same as in
+                        vTaskTimedReset(). Yield is held until the scheduler
+                        is resumed. */
+                        if( prvResortTimedReadyTask( pxTCB ) != pdFALSE )
+                        {
+                            taskYIELD_IF_USING_PREEMPTION();
+                        }
+                    }
+                    #endif /* configUSE_TIMED_EDF */
+                }
+                else
+                {
+                    pxTCB->ucJobState = tskJOB_WAITING;
+                }
+            }
+            taskEXIT_CRITICAL();
+
+            if( xTicksToRelease != ( TickType_t ) 0 )
+            {
+                prvAddCurrentTaskToDelayedList( xTicksToRelease, pdFALSE );
+            }
+        }
+        xAlreadyYielded = xTaskResumeAll();
+
+        if( ( xTicksToRelease != ( TickType_t ) 0 ) && ( xAlreadyYielded == pdFALSE ) )
+        {
+            portYIELD_WITHIN_API();
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        /* Delay was aborted, so the tick didn't release the job */
+        if( pxTCB->ucJobState == tskJOB_WAITING )
+        {
+            taskENTER_CRITICAL();
+            {
+                prvReleaseTimedJob( pxTCB );
+                pxTCB->ucJobState = tskJOB_STARTED;
+            }
+            taskEXIT_CRITICAL();
+        }
+    }
+#endif
+
+/*-----------------------------------------------------------*/
+
+#if( ( INCLUDE_xTaskCreateTimed == 1 ) && ( configUSE_TIMED_TASK_STATS == 1 ) )
+    BaseType_t xTaskGetTimedStats( TaskHandle_t xTask, TimedStats_t * const pxStats )
+    {
+        /* Read through volatile, so no field is read outside of the checks of
+         * the sequence */
+        const volatile TCB_t * const pxTCB = prvGetTCBFromHandle( xTask );
+        uint32_t ulSequence;
+        uint64_t ullTotal;
+        uint64_t ullLatencyTotal;
+        uint64_t ullResponseTotal;
+
+        configASSERT( pxStats );
+        configASSERT( pxTCB->eType == eTimed );
+
+        /* Writer is in a critical section, so the copy is only retried if
+         * the reader was interrupted by a job that ended */
+        do
+        {
+            ulSequence = pxTCB->ulStatsSequence;
+
+            pxStats->ulJobs = pxTCB->ulStatsJobs;
+            pxStats->ulMin = pxTCB->ulStatsMin;
+            pxStats->ulMax = pxTCB->ulStatsMax;
+            pxStats->ulWcet = pxTCB->ulStatsWcet;
+            pxStats->ulDeadlineMisses = pxTCB->ulStatsDeadlineMisses;
+            pxStats->ulJitterMax = pxTCB->ulStatsJitterMax;
+            pxStats->ulLatencyMax = pxTCB->ulStatsLatencyMax;
+            pxStats->ulResponseMax = pxTCB->ulStatsResponseMax;
+            ullTotal = pxTCB->ullStatsTotal;
+            ullLatencyTotal = pxTCB->ullStatsLatencyTotal;
+            ullResponseTotal = pxTCB->ullStatsResponseTotal;
+
+            for( UBaseType_t uxBucket = 0; uxBucket < ( UBaseType_t ) configTIMED_TASK_STATS_BUCKETS; uxBucket++ )
+            {
+                pxStats->ulBuckets[ uxBucket ] = pxTCB->ulStatsBuckets[ uxBucket ];
+            }
+
+            #if( configUSE_TIMED_BUDGET_WARNING == 1 )
+            {
+                pxStats->ulBudgetWarnings = pxTCB->ulBudgetWarnings;
+            }
+            #endif
+        } while( ( ( ulSequence & 1UL ) != 0UL ) || ( ulSequence != pxTCB->ulStatsSequence ) );
+
+        if( pxStats->ulJobs > 0UL )
+        {
+            pxStats->ulMean = ( uint32_t ) ( ullTotal / pxStats->ulJobs );
+            pxStats->ulLatencyMean = ( uint32_t ) ( ullLatencyTotal / pxStats->ulJobs );
+            pxStats->ulResponseMean = ( uint32_t ) ( ullResponseTotal / pxStats->ulJobs );
+        }
+        else
+        {
+            pxStats->ulMin = 0;
+            pxStats->ulMean = 0;
+            pxStats->ulResponseMean = 0;
+            pxStats->ulLatencyMean = 0;
+        }
+
+        return pdPASS;
+    }
+#endif
+
+/*-----------------------------------------------------------*/
+
+#if( ( INCLUDE_xTaskCreateTimed == 1 ) && ( configUSE_TIMED_TASK_STATS == 1 ) )
+    void vTaskTimedStatsClear( TaskHandle_t xTask )
+    {
+        TCB_t * const pxTCB = prvGetTCBFromHandle( xTask );
+
+        configASSERT( pxTCB->eType == eTimed );
+
+        taskENTER_CRITICAL();
+        {
+            pxTCB->ulStatsSequence++;
+            prvClearTimedStats( pxTCB );
+            pxTCB->ulStatsSequence++;
+        }
+        taskEXIT_CRITICAL();
+    }
+#endif
+
+/*-----------------------------------------------------------*/
+
+#if( ( INCLUDE_xTaskCreateTimed == 1 ) && ( configUSE_TIMED_BUDGET_WARNING == 1 ) )
+    uint32_t ulTaskTimedGetBudgetWarnings( TaskHandle_t xTask )
+    {
+        const TCB_t * const pxTCB = prvGetTCBFromHandle( xTask );
+
+        configASSERT( pxTCB->eType == eTimed );
+
+        return pxTCB->ulBudgetWarnings;
+    }
+#endif
+
+/*-----------------------------------------------------------*/
+
+#if( ( INCLUDE_xTaskCreateTimed == 1 ) && ( configUSE_TIMED_CRITICALITY == 1 ) )
+    BaseType_t xTaskTimedSetCriticality( TaskHandle_t xTask, eTimedCriticality eCriticality, TickType_t xOverrunTimeHi )
+    {
+        TCB_t * const pxTCB = prvGetTCBFromHandle( xTask );
+        BaseType_t xReturn = pdPASS;
+
+        configASSERT( pxTCB->eType == eTimed );
+        configASSERT( ( eCriticality == eTimedCriticalityLo ) || ( pxTCB->xOverrunTimer != NULL ) );
+
+        taskENTER_CRITICAL();
+        {
+            /* Budget the task was created with is kept for LO mode */
+            if( listLIST_ITEM_CONTAINER( &( pxTCB->xCriticalityListItem ) ) == NULL )
+            {
+                pxTCB->xOverrunTicksMaxLo = pxTCB->xOverrunTicksMax;
+                vListInsertEnd( &xCriticalityTimedTasks, &( pxTCB->xCriticalityListItem ) );
+            }
+
+            if( ( eCriticality == eTimedCriticalityHi ) && ( xOverrunTimeHi < pxTCB->xOverrunTicksMaxLo ) )
+            {
+                xReturn = pdFAIL;
+            }
+            else
+            {
+                pxTCB->ucCriticality = ( uint8_t ) eCriticality;
+                pxTCB->xOverrunTicksMaxHi = xOverrunTimeHi;
+
+                if( prvApplyTimedMode( pxTCB ) != pdFALSE )
+                {
+                    taskYIELD_IF_USING_PREEMPTION();
+                }
+
+                if( pxTCB->xOverrunTimer != NULL )
+                {
+                    prvRestartOverrunTime( pxTCB );
+                }
+            }
+        }
+        taskEXIT_CRITICAL();
+
+        return xReturn;
+    }
+#endif
+
+/*-----------------------------------------------------------*/
+
+#if( ( INCLUDE_xTaskCreateTimed == 1 ) && ( configUSE_TIMED_CRITICALITY == 1 ) )
+    eTimedCriticality eTaskTimedGetMode( void )
+    {
+        return eTimedMode;
+    }
+#endif
+
+/*-----------------------------------------------------------*/
+
+#if( ( INCLUDE_xTaskCreateTimed == 1 ) && ( configUSE_TIMED_SUPERVISOR == 1 ) )
+    void vTaskTimedSetSupervisor( TaskHandle_t xSupervisor )
+    {
+        taskENTER_CRITICAL();
+        {
+            /* Events of the previous supervisor aren't handed over */
+            xTimedSupervisor = xSupervisor;
+            uxTimedEventsHead = 0;
+            uxTimedEventsCount = 0;
+        }
+        taskEXIT_CRITICAL();
+    }
+#endif
+
+/*-----------------------------------------------------------*/
+
+#if( ( INCLUDE_xTaskCreateTimed == 1 ) && ( configUSE_TIMED_SUPERVISOR == 1 ) )
+    BaseType_t xTaskTimedReceiveEvent( TimedEvent_t * const pxEvent, TickType_t xTicksToWait )
+    {
+        TimeOut_t xTimeOut;
+        BaseType_t xReturn = pdFAIL;
+        BaseType_t xWaiting = pdTRUE;
+
+        configASSERT( pxEvent );
+        configASSERT( xTimedSupervisor == ( TaskHandle_t ) pxCurrentTCB );
+
+        vTaskSetTimeOutState( &xTimeOut );
+
+        while( xWaiting != pdFALSE )
+        {
+            taskENTER_CRITICAL();
+            {
+                if( uxTimedEventsCount > ( UBaseType_t ) 0U )
+                {
+                    *pxEvent = xTimedEvents[ uxTimedEventsHead ];
+                    uxTimedEventsHead = ( uxTimedEventsHead + ( UBaseType_t ) 1U ) % ( UBaseType_t ) configTIMED_EVENT_QUEUE_LENGTH;
+                    uxTimedEventsCount--;
+                    xReturn = pdPASS;
+                    xWaiting = pdFALSE;
+                }
+            }
+            taskEXIT_CRITICAL();
+
+            if( xWaiting != pdFALSE )
+            {
+                /* Event posted since the check has already notified the
+                 * task, so the take doesn't block */
+                if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdFALSE )
+                {
+                    ( void ) ulTaskNotifyTake( pdTRUE, xTicksToWait );
+                }
+                else
+                {
+                    xWaiting = pdFALSE;
+                }
+            }
+        }
+
+        return xReturn;
+    }
+#endif
+
+/*-----------------------------------------------------------*/
+
+#if( ( INCLUDE_xTaskCreateTimed == 1 ) && ( configUSE_TIMED_TASK_STATS == 1 ) )
+    static void prvRecordTimedJob( TCB_t * const pxTCB )
+    {
+        uint32_t ulRunTime = pxTCB->ulRunTimeCounter;
+        uint32_t ulJob;
+        uint32_t ulTime;
+        UBaseType_t uxBucket = 0;
+
+        /* Running task isn't charged for the current slice yet */
+        if( pxTCB == pxCurrentTCB )
+        {
+            ulRunTime += portGET_RUN_TIME_COUNTER_VALUE() - ulTaskSwitchedInTime;
+        }
+
+        ulJob = ulRunTime - pxTCB->ulJobStartRunTime;
+        pxTCB->ulJobStartRunTime = ulRunTime;
+
+        /* Bucket is the position of the highest set bit */
+        for( ulTime = ulJob; ( ulTime != 0UL ) && ( uxBucket < ( UBaseType_t ) ( configTIMED_TASK_STATS_BUCKETS - 1 ) ); ulTime >>= 1 )
+        {
+            uxBucket++;
+        }
+
+        pxTCB->ulStatsSequence++;
+
+        pxTCB->ulStatsJobs++;
+        pxTCB->ullStatsTotal += ulJob;
+        pxTCB->ulStatsBuckets[ uxBucket ]++;
+
+        if( ulJob < pxTCB->ulStatsMin )
+        {
+            pxTCB->ulStatsMin = ulJob;
+        }
+
+        if( ulJob > pxTCB->ulStatsMax )
+        {
+            pxTCB->ulStatsMax = ulJob;
+        }
+
+        if( ulJob > pxTCB->ulStatsWcet )
+        {
+            pxTCB->ulStatsWcet = ulJob;
+        }
+
+        pxTCB->ulStatsSequence++;
+    }
+#endif
+
+/*-----------------------------------------------------------*/
+
+#if( ( INCLUDE_xTaskCreateTimed == 1 ) && ( configUSE_TIMED_TASK_STATS == 1 ) )
+    static void prvClearTimedStats( TCB_t * const pxTCB )
+    {
+        pxTCB->ulStatsJobs = 0;
+        pxTCB->ulStatsMin = ( uint32_t ) 0xffffffffUL;
+        pxTCB->ulStatsMax = 0;
+        pxTCB->ullStatsTotal = 0;
+        ( void ) memset( pxTCB->ulStatsBuckets, 0x00, sizeof( pxTCB->ulStatsBuckets ) );
+        pxTCB->ulStatsDeadlineMisses = 0;
+        pxTCB->ulStatsJitterMax = 0;
+        pxTCB->ulStatsLatencyMax = 0;
+        pxTCB->ulStatsResponseMax = 0;
+        pxTCB->ullStatsLatencyTotal = 0;
+        pxTCB->ullStatsResponseTotal = 0;
+
+        #if( configUSE_TIMED_BUDGET_WARNING == 1 )
+        {
+            pxTCB->ulBudgetWarnings = 0;
+        }
+        #endif
+    }
+#endif
+
+/*-----------------------------------------------------------*/
+
+#if( ( INCLUDE_xTaskCreateTimed == 1 ) && ( configTIMED_BUDGET_IN_RUN_TIME_COUNTS == 1 ) )
+    void vTaskTimedBudgetExpiredFromISR( BaseType_t * const pxHigherPriorityTaskWoken )
+    {
+        UBaseType_t uxSavedInterruptStatus;
+        uint32_t ulSliceCounts;
+
+        uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+        {
+            if( pxCurrentTCB->xOverrunTimer != NULL )
+            {
+                ulSliceCounts = portGET_RUN_TIME_COUNTER_VALUE() - ulTaskSwitchedInTime;
+
+                if( ( prvCheckOverrunBudget( pxCurrentTCB, ulSliceCounts ) != pdFALSE ) &&
+                    ( pxHigherPriorityTaskWoken != NULL ) )
+                {
+                    *pxHigherPriorityTaskWoken = pdTRUE;
+                }
+
+                /* Budget restarted, the warning was raised, or the
+                interrupt came early. A throttled task waits for the
+                replenishment. */
+                ulSliceCounts += pxCurrentTCB->xOverrunTicks;
+
+                if( ( pxCurrentTCB->ucIsThrottled == pdFALSE ) && ( ulSliceCounts < pxCurrentTCB->xOverrunTicksMax ) )
+                {
+                    configTIMED_BUDGET_ARM( taskTIMED_NEXT_BUDGET_CHECK( pxCurrentTCB, ulSliceCounts ) - ulSliceCounts );
+                }
+            }
+        }
+        portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+    }
+#endif
+
+/*-----------------------------------------------------------*/
+
+#if( ( INCLUDE_xTaskCreateTimed == 1 ) && ( configTIMED_BUDGET_IN_RUN_TIME_COUNTS == 1 ) )
+    static BaseType_t prvCheckOverrunBudget( TCB_t * const pxTCB, const uint32_t ulSliceCounts )
+    {
+        BaseType_t xSwitchRequired = pdFALSE;
+
+        #if( configUSE_TIMED_BUDGET_WARNING == 1 )
+        {
+            prvCheckBudgetWarning( pxTCB, ( TickType_t ) ( pxTCB->xOverrunTicks + ulSliceCounts ), &xSwitchRequired );
+        }
+        #endif
+
+        /* xOverrunTicks holds the counts up to the switch in */
+        if( ( TickType_t ) ( pxTCB->xOverrunTicks + ulSliceCounts ) >= pxTCB->xOverrunTicksMax )
+        {
+            #if( configUSE_TIMED_CRITICALITY == 1 )
+            if( ( pxTCB->ucCriticality == ( uint8_t ) eTimedCriticalityHi ) && ( eTimedMode == eTimedCriticalityLo ) )
+            {
+                /* HI task keeps running on its HI budget. Lists can't be
+                 * changed with the scheduler suspended, the mode is switched
+                 * on the switch out. */
+                if( uxSchedulerSuspended != ( UBaseType_t ) pdFALSE )
+                {
+                    xYieldPending = pdTRUE;
+                }
+                else
+                {
+                    xSwitchRequired = prvSetTimedMode( eTimedCriticalityHi );
+                }
+            }
+            else
+            #endif /* configUSE_TIMED_CRITICALITY */
+            if( pxTCB->ucEnforcement == ( uint8_t ) eTimedEnforceNone )
+            {
+                /* Budget restarts now. Counts of the slice so far are taken
+                 * away, as the whole slice is added on the switch out. */
+                pxTCB->xOverrunTicks = ( TickType_t ) 0U - ulSliceCounts;
+
+                #if( configUSE_TIMED_BUDGET_WARNING == 1 )
+                {
+                    pxTCB->ucIsWarned = pdFALSE;
+                }
+                #endif
+
+                prvForwardTimedEvent( pxTCB, pxTCB->xOverrunTimer, &xSwitchRequired );
+            }
+            else if( uxSchedulerSuspended != ( UBaseType_t ) pdFALSE )
+            {
+                /* Ready lists can't be changed now, the budget is enforced
+                 * on the switch out when the scheduler is resumed. */
+                xYieldPending = pdTRUE;
+            }
+            else
+            {
+                xSwitchRequired = prvThrottleTimedTask( pxTCB );
+            }
+        }
+
+        return xSwitchRequired;
+    }
+#endif
+
+/*-----------------------------------------------------------*/
+
+#if( INCLUDE_xTaskCreateTimed == 1 )
+    static BaseType_t prvCheckTimedTasks( const TickType_t xConstTickCount )
+    {
+        BaseType_t xSwitchRequired = pdFALSE;
+
+        /* Budgets of enforced tasks. Replenished first, so a budget that
+         * runs out on the tick of its replenishment isn't enforced. */
+        if( listLIST_IS_EMPTY( &xReplenishTimedTasks ) == pdFALSE )
+        {
+            if( xTicksToReplenishCheck > ( TickType_t ) 1 )
+            {
+                xTicksToReplenishCheck--;
+            }
+            else
+            {
+                const ListItem_t * const pxEnd = listGET_END_MARKER( &xReplenishTimedTasks );
+                ListItem_t * pxItem;
+                ListItem_t * pxNext;
+                TCB_t * pxTCB;
+                TickType_t xRemaining;
+
+                xTicksToReplenishCheck = portMAX_DELAY;
+
+                for( pxItem = listGET_HEAD_ENTRY( &xReplenishTimedTasks ); pxItem != pxEnd; pxItem = pxNext )
+                {
+                    /* Sporadic replenishment removes the item */
+                    pxNext = listGET_NEXT( pxItem );
+                    pxTCB = ( TCB_t * ) listGET_LIST_ITEM_OWNER( pxItem );
+                    xRemaining = listGET_LIST_ITEM_VALUE( pxItem ) - xConstTickCount;
+
+                    /* Replenishment that is due wraps above the period */
+                    if( ( xRemaining == ( TickType_t ) 0 ) || ( xRemaining > pxTCB->xReplenishPeriod ) )
+                    {
+                        if( prvReplenishTimedTask( pxTCB ) != pdFALSE )
+                        {
+                            xSwitchRequired = pdTRUE;
+                        }
+
+                        xRemaining = pxTCB->xReplenishPeriod;
+                    }
+
+                    if( ( listLIST_ITEM_CONTAINER( pxItem ) != NULL ) && ( xRemaining < xTicksToReplenishCheck ) )
+                    {
+                        xTicksToReplenishCheck = xRemaining;
+                    }
+                }
+            }
+        }
+
+        /* Running time of the current task. With run time counts it is
+         * charged on the context switch and the budget interrupt instead. */
+        #if( configTIMED_BUDGET_IN_RUN_TIME_COUNTS == 0 )
+        {
+            if( pxCurrentTCB->xOverrunTimer != NULL )
+            {
+                pxCurrentTCB->xOverrunTicks++;
+
+                #if( configUSE_TIMED_BUDGET_WARNING == 1 )
+                {
+                    prvCheckBudgetWarning( pxCurrentTCB, pxCurrentTCB->xOverrunTicks, &xSwitchRequired );
+                }
+                #endif
+
+                if( pxCurrentTCB->xOverrunTicks >= pxCurrentTCB->xOverrunTicksMax )
+                {
+                    #if( configUSE_TIMED_CRITICALITY == 1 )
+                    if( ( pxCurrentTCB->ucCriticality == ( uint8_t ) eTimedCriticalityHi ) && ( eTimedMode == eTimedCriticalityLo ) )
+                    {
+                        /* HI task keeps running on its HI budget */
+                        if( prvSetTimedMode( eTimedCriticalityHi ) != pdFALSE )
+                        {
+                            xSwitchRequired = pdTRUE;
+                        }
+                    }
+                    else
+                    #endif /* configUSE_TIMED_CRITICALITY */
+                    if( pxCurrentTCB->ucEnforcement == ( uint8_t ) eTimedEnforceNone )
+                    {
+                        pxCurrentTCB->xOverrunTicks = 0;
+
+                        #if( configUSE_TIMED_BUDGET_WARNING == 1 )
+                        {
+                            pxCurrentTCB->ucIsWarned = pdFALSE;
+                        }
+                        #endif
+
+                        prvForwardTimedEvent( pxCurrentTCB, pxCurrentTCB->xOverrunTimer, &xSwitchRequired );
+                    }
+                    else if( prvThrottleTimedTask( pxCurrentTCB ) != pdFALSE )
+                    {
+                        xSwitchRequired = pdTRUE;
+                    }
+                }
+            }
+        }
+        #endif /* configTIMED_BUDGET_IN_RUN_TIME_COUNTS */
+
+        /* Overflow time of all tracked tasks. Tracked tasks are visited only
+         * when the earliest of them can overflow. */
+        if( listLIST_IS_EMPTY( &xOverflowTrackedTasks ) == pdFALSE )
+        {
+            if( xTicksToOverflowCheck > ( TickType_t ) 1 )
+            {
+                xTicksToOverflowCheck--;
+            }
+            else
+            {
+                const ListItem_t * const pxEnd = listGET_END_MARKER( &xOverflowTrackedTasks );
+                ListItem_t * pxItem;
+                TCB_t * pxTCB;
+                TickType_t xElapsed;
+                TickType_t xRemaining;
+
+                xTicksToOverflowCheck = portMAX_DELAY;
+
+                for( pxItem = listGET_HEAD_ENTRY( &xOverflowTrackedTasks ); pxItem != pxEnd; pxItem = listGET_NEXT( pxItem ) )
+                {
+                    pxTCB = ( TCB_t * ) listGET_LIST_ITEM_OWNER( pxItem );
+                    xElapsed = xConstTickCount - pxTCB->xOverflowStartTick;
+
+                    if( xElapsed >= pxTCB->xOverflowTicksMax )
+                    {
+                        /* Restarts, as the auto-reloaded timer did */
+                        pxTCB->xOverflowStartTick = xConstTickCount;
+                        xRemaining = pxTCB->xOverflowTicksMax;
+                        prvForwardTimedEvent( pxTCB, pxTCB->xOverflowTimer, &xSwitchRequired );
+                    }
+                    else
+                    {
+                        xRemaining = pxTCB->xOverflowTicksMax - xElapsed;
+                    }
+
+                    if( xRemaining < xTicksToOverflowCheck )
+                    {
+                        xTicksToOverflowCheck = xRemaining;
+                    }
+                }
+            }
+        }
+
+        return xSwitchRequired;
+    }
+#endif
+
+/*-----------------------------------------------------------*/
+
+#if( ( INCLUDE_xTaskCreateTimed == 1 ) && ( configUSE_TIMED_EDF == 1 ) )
+    static TickType_t prvGetTimedDeadline( const TCB_t * const pxTCB )
+    {
+    TickType_t xDeadline;
+
+        if( ( pxTCB->eType != eTimed ) || ( pxTCB->xOverflowTimer == NULL ) )
+        {
+            xDeadline = portMAX_DELAY;
+        }
+        else if( listLIST_ITEM_CONTAINER( &( pxTCB->xOverflowListItem ) ) == NULL )
+        {
+            /* Not tracked until it runs, the deadline counts from now */
+            xDeadline = xTickCount + pxTCB->xOverflowTicksMax;
+        }
+        else
+        {
+            xDeadline = pxTCB->xOverflowStartTick + pxTCB->xOverflowTicksMax;
+        }
+
+        /* portMAX_DELAY is reserved for tasks without a deadline */
+        if( xDeadline == portMAX_DELAY )
+        {
+            xDeadline--;
+        }
+
+        return xDeadline;
+    }
+
+/*-----------------------------------------------------------*/
+
+    static void prvInsertTimedReadyList( ListItem_t * const pxNewListItem )
+    {
+    List_t * const pxList = &( pxReadyTasksLists[ configTIMED_EDF_PRIORITY ] );
+    const TickType_t xDeadline = listGET_LIST_ITEM_VALUE( pxNewListItem );
+    ListItem_t *pxIterator;
+    TickType_t xOther;
+
+        /* Find the first item with a later deadline. Tasks without a deadline
+        go to the end, the others are compared by the signed difference of
+        the deadlines, which doesn't change when the tick count wraps. */
+        if( xDeadline == portMAX_DELAY )
+        {
+            pxIterator = ( ListItem_t * ) listGET_END_MARKER( pxList );
+        }
+        else
+        {
+            for( pxIterator = listGET_HEAD_ENTRY( pxList ); pxIterator != listGET_END_MARKER( pxList ); pxIterator = listGET_NEXT( pxIterator ) )
+            {
+                xOther = listGET_LIST_ITEM_VALUE( pxIterator );
+
+                if( ( xOther == portMAX_DELAY ) || ( ( BaseType_t ) ( xDeadline - xOther ) < ( BaseType_t ) 0 ) )
+                {
+                    break;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+        }
+
+        /* Same as vListInsert(), but in front of pxIterator */
+        pxNewListItem->pxNext = pxIterator;
+        pxNewListItem->pxPrevious = pxIterator->pxPrevious;
+        pxIterator->pxPrevious->pxNext = pxNewListItem;
+        pxIterator->pxPrevious = pxNewListItem;
+        pxNewListItem->pvContainer = ( void * ) pxList;
+
+        ( pxList->uxNumberOfItems )++;
+    }
+
+/*-----------------------------------------------------------*/
+
+    static TCB_t * prvSelectTimedReadyTask( void )
+    {
+    List_t * const pxList = &( pxReadyTasksLists[ configTIMED_EDF_PRIORITY ] );
+    ListItem_t * const pxHead = listGET_HEAD_ENTRY( pxList );
+    ListItem_t * const pxNext = listGET_NEXT( pxHead );
+
+        /* The running task shares the processor with the tasks of the same
+        deadline, as listGET_OWNER_OF_NEXT_ENTRY() does for other priorities */
+        if( ( pxHead == &( pxCurrentTCB->xStateListItem ) ) &&
+            ( pxNext != listGET_END_MARKER( pxList ) ) &&
+            ( listGET_LIST_ITEM_VALUE( pxNext ) == listGET_LIST_ITEM_VALUE( pxHead ) ) )
+        {
+            ( void ) uxListRemove( pxHead );
+            prvInsertTimedReadyList( pxHead );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return ( TCB_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxList );
+    }
+
+/*-----------------------------------------------------------*/
+
+    static BaseType_t prvResortTimedReadyTask( TCB_t * const pxTCB )
+    {
+        BaseType_t xSwitchRequired = pdFALSE;
+
+        if( listIS_CONTAINED_WITHIN( &( pxReadyTasksLists[ configTIMED_EDF_PRIORITY ] ), &( pxTCB->xStateListItem ) ) != pdFALSE )
+        {
+            ( void ) uxListRemove( &( pxTCB->xStateListItem ) );
+            taskINSERT_INTO_READY_LIST( pxTCB );
+
+            if( ( pxCurrentTCB->uxPriority == ( UBaseType_t ) configTIMED_EDF_PRIORITY ) &&
+                ( listGET_OWNER_OF_HEAD_ENTRY( &( pxReadyTasksLists[ configTIMED_EDF_PRIORITY ] ) ) != pxCurrentTCB ) )
+            {
+                xSwitchRequired = pdTRUE;
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return xSwitchRequired;
+    }
+#endif
+
+/*-----------------------------------------------------------*/
+
+#if( INCLUDE_xTaskCreateTimed == 1 )
+    static void prvStartOverflowTracking( TCB_t * const pxTCB )
+    {
+        pxTCB->xOverflowStartTick = xTickCount;
+
+        if( listLIST_ITEM_CONTAINER( &( pxTCB->xOverflowListItem ) ) == NULL )
+        {
+            vListInsertEnd( &xOverflowTrackedTasks, &( pxTCB->xOverflowListItem ) );
+        }
+
+        /* Reset only moves the overflow later, so the check can't be late */
+        if( pxTCB->xOverflowTicksMax < xTicksToOverflowCheck )
+        {
+            xTicksToOverflowCheck = pxTCB->xOverflowTicksMax;
+        }
+    }
+#endif
+
+/*-----------------------------------------------------------*/
+
+#if( INCLUDE_xTaskCreateTimed == 1 )
+    static void prvForwardTimedEvent( TCB_t * const pxTCB, TimerHandle_t xTimer, BaseType_t * const pxSwitchRequired )
+    {
+        BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+
+        #if( configUSE_TIMED_SUPERVISOR == 1 )
+        if( ( xTimedSupervisor != NULL ) &&
+            ( prvPostTimedEvent( pxTCB, xTimer, ( xTimer == pxTCB->xOverrunTimer ) ? eTimedEventOverrun : eTimedEventOverflow ) != pdFAIL ) )
+        {
+            /* Interrupts are already masked, the notification doesn't need
+             * a critical section of its own */
+            vTaskNotifyGiveFromISR( xTimedSupervisor, &xHigherPriorityTaskWoken );
+        }
+        else
+        #else
+        ( void ) pxTCB;
+        #endif /* configUSE_TIMED_SUPERVISOR */
+        {
+            /* Timer has the period of 1, so started a tick ago it has already
+             * expired. If the daemon's queue is full the event is lost. */
+            ( void ) xTimerGenericCommand( xTimer,
+                                           tmrCOMMAND_RESET_FROM_ISR,
+                                           xTickCount - ( TickType_t ) 1U,
+                                           &xHigherPriorityTaskWoken,
+                                           0U );
+        }
+
+        if( xHigherPriorityTaskWoken != pdFALSE )
+        {
+            *pxSwitchRequired = pdTRUE;
+        }
+    }
+#endif
+
+/*-----------------------------------------------------------*/
+
+#if( ( INCLUDE_xTaskCreateTimed == 1 ) && ( configUSE_TIMED_SUPERVISOR == 1 ) )
+    static BaseType_t prvPostTimedEvent( TCB_t * const pxTCB, TimerHandle_t xTimer, const eTimedEvent eEvent )
+    {
+        TimedEvent_t * pxEvent;
+        BaseType_t xReturn = pdFAIL;
+
+        if( uxTimedEventsCount < ( UBaseType_t ) configTIMED_EVENT_QUEUE_LENGTH )
+        {
+            pxEvent = &( xTimedEvents[ ( uxTimedEventsHead + uxTimedEventsCount ) % ( UBaseType_t ) configTIMED_EVENT_QUEUE_LENGTH ] );
+            pxEvent->xTask = ( TaskHandle_t ) pxTCB;
+            pxEvent->xTimer = xTimer;
+            pxEvent->eEvent = eEvent;
+            pxEvent->xTickCount = xTickCount;
+
+            #if( ( configGENERATE_RUN_TIME_STATS == 1 ) && defined( portGET_RUN_TIME_COUNTER_VALUE ) )
+            {
+                pxEvent->ulRunTimeCounter = portGET_RUN_TIME_COUNTER_VALUE();
+            }
+            #else
+            {
+                pxEvent->ulRunTimeCounter = 0UL;
+            }
+            #endif
+
+            uxTimedEventsCount++;
+            xReturn = pdPASS;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return xReturn;
+    }
+#endif
+
+/*-----------------------------------------------------------*/
+
+#if( ( INCLUDE_xTaskCreateTimed == 1 ) && ( configUSE_TIMED_BUDGET_WARNING == 1 ) )
+    static void prvCheckBudgetWarning( TCB_t * const pxTCB, const TickType_t xUsed, BaseType_t * const pxSwitchRequired )
+    {
+        if( ( pxTCB->ucIsWarned == pdFALSE ) && ( xUsed >= pxTCB->xOverrunTicksWarning ) )
+        {
+            pxTCB->ucIsWarned = pdTRUE;
+            pxTCB->ulBudgetWarnings++;
+            traceTIMED_BUDGET_WARNING( pxTCB );
+
+            /* Only the supervisor is told, the timer daemon has no callback
+             * for it */
+            #if( configUSE_TIMED_SUPERVISOR == 1 )
+            {
+                BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+
+                if( ( xTimedSupervisor != NULL ) &&
+                    ( prvPostTimedEvent( pxTCB, pxTCB->xOverrunTimer, eTimedEventWarning ) != pdFAIL ) )
+                {
+                    vTaskNotifyGiveFromISR( xTimedSupervisor, &xHigherPriorityTaskWoken );
+
+                    if( xHigherPriorityTaskWoken != pdFALSE )
+                    {
+                        *pxSwitchRequired = pdTRUE;
+                    }
+                }
+            }
+            #else
+            {
+                ( void ) pxSwitchRequired;
+            }
+            #endif /* configUSE_TIMED_SUPERVISOR */
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+#endif
+
+/*-----------------------------------------------------------*/
+
+#if( INCLUDE_xTaskCreateTimed == 1 )
+    static void prvRestartOverrunTime( TCB_t * const pxTCB )
+    {
+        #if( configUSE_TIMED_BUDGET_WARNING == 1 )
+        {
+            pxTCB->ucIsWarned = pdFALSE;
+        }
+        #endif
+
+        #if( configTIMED_BUDGET_IN_RUN_TIME_COUNTS == 1 )
+        {
+            if( pxTCB == pxCurrentTCB )
+            {
+                /* Time of the slice so far isn't charged, it is added
+                again on the switch out */
+                pxTCB->xOverrunTicks = ( TickType_t ) 0U - ( portGET_RUN_TIME_COUNTER_VALUE() - ulTaskSwitchedInTime );
+                configTIMED_BUDGET_ARM( taskTIMED_NEXT_BUDGET_CHECK( pxTCB, 0U ) );
+            }
+            else
+            {
+                pxTCB->xOverrunTicks = 0;
+            }
+        }
+        #else
+        {
+            pxTCB->xOverrunTicks = 0;
+        }
+        #endif /* configTIMED_BUDGET_IN_RUN_TIME_COUNTS */
+    }
+#endif
+
+/*-----------------------------------------------------------*/
+
+#if( INCLUDE_xTaskCreateTimed == 1 )
+    static BaseType_t prvThrottleTimedTask( TCB_t * const pxTCB )
+    {
+        BaseType_t xSwitchRequired = pdFALSE;
+        TickType_t xTicksToReplenish;
+
+        if( pxTCB->ucIsThrottled == pdFALSE )
+        {
+            pxTCB->ucIsThrottled = pdTRUE;
+            prvForwardTimedEvent( pxTCB, pxTCB->xOverrunTimer, &xSwitchRequired );
+
+            if( listLIST_ITEM_CONTAINER( &( pxTCB->xReplenishListItem ) ) == NULL )
+            {
+                prvScheduleReplenishment( pxTCB, pxTCB->xReplenishPeriod );
+            }
+
+            /* Base priority is demoted once, so a priority inherited from a
+            mutex is kept until the mutex is given back */
+            if( pxTCB->ucEnforcement != ( uint8_t ) eTimedEnforceSuspend )
+            {
+                pxTCB->uxThrottledPriority = taskTIMED_BASE_PRIORITY( pxTCB );
+
+                if( taskTIMED_BASE_PRIORITY( pxTCB ) > ( UBaseType_t ) configTIMED_THROTTLE_PRIORITY )
+                {
+                    prvSetTimedPriority( pxTCB, ( UBaseType_t ) configTIMED_THROTTLE_PRIORITY );
+                    xSwitchRequired = pdTRUE;
+                }
+            }
+        }
+
+        /* Suspended task is delayed until the replenishment, also when it
+        was woken before it */
+        if( ( pxTCB->ucEnforcement == ( uint8_t ) eTimedEnforceSuspend ) &&
+            ( listIS_CONTAINED_WITHIN( &( pxReadyTasksLists[ pxTCB->uxPriority ] ), &( pxTCB->xStateListItem ) ) != pdFALSE ) )
+        {
+            xTicksToReplenish = listGET_LIST_ITEM_VALUE( &( pxTCB->xReplenishListItem ) ) - xTickCount;
+
+            if( ( xTicksToReplenish == ( TickType_t ) 0 ) || ( xTicksToReplenish > pxTCB->xReplenishPeriod ) )
+            {
+                xTicksToReplenish = 1;
+            }
+
+            /* Only the running task can run out of its budget */
+            configASSERT( pxTCB == pxCurrentTCB );
+            prvAddCurrentTaskToDelayedList( xTicksToReplenish, pdFALSE );
+            xSwitchRequired = pdTRUE;
+        }
+
+        return xSwitchRequired;
+    }
+#endif
+
+/*-----------------------------------------------------------*/
+
+#if( INCLUDE_xTaskCreateTimed == 1 )
+    static BaseType_t prvReplenishTimedTask( TCB_t * const pxTCB )
+    {
+        BaseType_t xSwitchRequired = pdFALSE;
+
+        prvRestartOverrunTime( pxTCB );
+
+        if( pxTCB->ucEnforcement == ( uint8_t ) eTimedEnforceSporadic )
+        {
+            if( listLIST_ITEM_CONTAINER( &( pxTCB->xReplenishListItem ) ) != NULL )
+            {
+                ( void ) uxListRemove( &( pxTCB->xReplenishListItem ) );
+            }
+        }
+        else
+        {
+            listSET_LIST_ITEM_VALUE( &( pxTCB->xReplenishListItem ), listGET_LIST_ITEM_VALUE( &( pxTCB->xReplenishListItem ) ) + pxTCB->xReplenishPeriod );
+        }
+
+        if( pxTCB->ucIsThrottled != pdFALSE )
+        {
+            pxTCB->ucIsThrottled = pdFALSE;
+
+            /* Not restored if the priority was changed since the demotion */
+            if( ( pxTCB->ucEnforcement != ( uint8_t ) eTimedEnforceSuspend ) &&
+                ( taskTIMED_BASE_PRIORITY( pxTCB ) == ( UBaseType_t ) configTIMED_THROTTLE_PRIORITY ) )
+            {
+                prvSetTimedPriority( pxTCB, pxTCB->uxThrottledPriority );
+
+                if( pxTCB->uxPriority > pxCurrentTCB->uxPriority )
+                {
+                    xSwitchRequired = pdTRUE;
+                }
+            }
+        }
+
+        return xSwitchRequired;
+    }
+#endif
+
+/*-----------------------------------------------------------*/
+
+#if( INCLUDE_xTaskCreateTimed == 1 )
+    static void prvScheduleReplenishment( TCB_t * const pxTCB, const TickType_t xTicks )
+    {
+        listSET_LIST_ITEM_VALUE( &( pxTCB->xReplenishListItem ), xTickCount + xTicks );
+
+        if( listLIST_ITEM_CONTAINER( &( pxTCB->xReplenishListItem ) ) == NULL )
+        {
+            vListInsertEnd( &xReplenishTimedTasks, &( pxTCB->xReplenishListItem ) );
+        }
+
+        if( xTicks < xTicksToReplenishCheck )
+        {
+            xTicksToReplenishCheck = xTicks;
+        }
+    }
+#endif
+
+/*-----------------------------------------------------------*/
+
+#if( INCLUDE_xTaskCreateTimed == 1 )
+    static void prvSetTimedPriority( TCB_t * const pxTCB, const UBaseType_t uxNewPriority )
+    {
+        const UBaseType_t uxPriorityUsedOnEntry = pxTCB->uxPriority;
+
+        /* Same as vTaskPrioritySet(), without the yield. An inherited
+        priority is kept until the mutex is given back. */
+        #if( configUSE_MUTEXES == 1 )
+        {
+            if( pxTCB->uxBasePriority == pxTCB->uxPriority )
+            {
+                pxTCB->uxPriority = uxNewPriority;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            pxTCB->uxBasePriority = uxNewPriority;
+        }
+        #else
+        {
+            pxTCB->uxPriority = uxNewPriority;
+        }
+        #endif
+
+        if( ( listGET_LIST_ITEM_VALUE( &( pxTCB->xEventListItem ) ) & taskEVENT_LIST_ITEM_VALUE_IN_USE ) == 0UL )
+        {
+            listSET_LIST_ITEM_VALUE( &( pxTCB->xEventListItem ), ( ( TickType_t ) configMAX_PRIORITIES - ( TickType_t ) uxNewPriority ) ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        if( ( pxTCB->uxPriority != uxPriorityUsedOnEntry ) &&
+            ( listIS_CONTAINED_WITHIN( &( pxReadyTasksLists[ uxPriorityUsedOnEntry ] ), &( pxTCB->xStateListItem ) ) != pdFALSE ) )
+        {
+            if( uxListRemove( &( pxTCB->xStateListItem ) ) == ( UBaseType_t ) 0 )
+            {
+                portRESET_READY_PRIORITY( uxPriorityUsedOnEntry, uxTopReadyPriority );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            prvAddTaskToReadyList( pxTCB );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+#endif
+
+/*-----------------------------------------------------------*/
+
+#if( ( INCLUDE_xTaskCreateTimed == 1 ) && ( configUSE_TIMED_CRITICALITY == 1 ) )
+    static BaseType_t prvSetTimedMode( const eTimedCriticality eMode )
+    {
+        const ListItem_t * const pxEnd = listGET_END_MARKER( &xCriticalityTimedTasks );
+        ListItem_t * pxItem;
+        BaseType_t xSwitchRequired = pdFALSE;
+
+        eTimedMode = eMode;
+
+        for( pxItem = listGET_HEAD_ENTRY( &xCriticalityTimedTasks ); pxItem != pxEnd; pxItem = listGET_NEXT( pxItem ) )
+        {
+            if( prvApplyTimedMode( ( TCB_t * ) listGET_LIST_ITEM_OWNER( pxItem ) ) != pdFALSE )
+            {
+                xSwitchRequired = pdTRUE;
+            }
+        }
+
+        return xSwitchRequired;
+    }
+#endif
+
+/*-----------------------------------------------------------*/
+
+#if( ( INCLUDE_xTaskCreateTimed == 1 ) && ( configUSE_TIMED_CRITICALITY == 1 ) )
+    static BaseType_t prvApplyTimedMode( TCB_t * const pxTCB )
+    {
+        BaseType_t xSwitchRequired = pdFALSE;
+        BaseType_t xIsThrottled;
+        UBaseType_t uxNewPriority;
+
+        /* Budget counted so far is kept, only the limit moves */
+        if( ( pxTCB->ucCriticality == ( uint8_t ) eTimedCriticalityHi ) && ( eTimedMode == eTimedCriticalityHi ) )
+        {
+            pxTCB->xOverrunTicksMax = pxTCB->xOverrunTicksMaxHi;
+        }
+        else
+        {
+            pxTCB->xOverrunTicksMax = pxTCB->xOverrunTicksMaxLo;
+        }
+
+        #if( configUSE_TIMED_BUDGET_WARNING == 1 )
+        {
+            pxTCB->xOverrunTicksWarning = taskTIMED_WARNING_THRESHOLD( pxTCB->xOverrunTicksMax );
+        }
+        #endif
+
+        /* Demoted by the throttling, the priority to restore is kept in
+        uxThrottledPriority instead */
+        xIsThrottled = ( ( pxTCB->ucIsThrottled != pdFALSE ) &&
+                         ( pxTCB->ucEnforcement != ( uint8_t ) eTimedEnforceSuspend ) ) ? pdTRUE : pdFALSE;
+
+        if( ( pxTCB->ucCriticality == ( uint8_t ) eTimedCriticalityLo ) && ( eTimedMode == eTimedCriticalityHi ) )
+        {
+            if( pxTCB->ucIsModeDemoted == pdFALSE )
+            {
+                pxTCB->ucIsModeDemoted = pdTRUE;
+
+                if( xIsThrottled != pdFALSE )
+                {
+                    /* Replenishment restores the HI mode priority */
+                    pxTCB->uxModePriority = pxTCB->uxThrottledPriority;
+
+                    if( pxTCB->uxThrottledPriority > ( UBaseType_t ) configTIMED_HI_MODE_LO_PRIORITY )
+                    {
+                        pxTCB->uxThrottledPriority = ( UBaseType_t ) configTIMED_HI_MODE_LO_PRIORITY;
+                    }
+                }
+                else
+                {
+                    pxTCB->uxModePriority = taskTIMED_BASE_PRIORITY( pxTCB );
+                }
+
+                if( taskTIMED_BASE_PRIORITY( pxTCB ) > ( UBaseType_t ) configTIMED_HI_MODE_LO_PRIORITY )
+                {
+                    prvSetTimedPriority( pxTCB, ( UBaseType_t ) configTIMED_HI_MODE_LO_PRIORITY );
+
+                    if( pxTCB == pxCurrentTCB )
+                    {
+                        xSwitchRequired = pdTRUE;
+                    }
+                }
+            }
+        }
+        else if( pxTCB->ucIsModeDemoted != pdFALSE )
+        {
+            pxTCB->ucIsModeDemoted = pdFALSE;
+
+            if( xIsThrottled != pdFALSE )
+            {
+                /* Throttled until the replenishment, which restores the
+                priority from before HI mode */
+                pxTCB->uxThrottledPriority = pxTCB->uxModePriority;
+                uxNewPriority = ( pxTCB->uxModePriority > ( UBaseType_t ) configTIMED_THROTTLE_PRIORITY ) ?
+                                ( UBaseType_t ) configTIMED_THROTTLE_PRIORITY : pxTCB->uxModePriority;
+            }
+            else
+            {
+                uxNewPriority = pxTCB->uxModePriority;
+            }
+
+            /* Not restored if the priority was changed since the demotion */
+            if( taskTIMED_BASE_PRIORITY( pxTCB ) == ( UBaseType_t ) configTIMED_HI_MODE_LO_PRIORITY )
+            {
+                prvSetTimedPriority( pxTCB, uxNewPriority );
+
+                if( pxTCB->uxPriority > pxCurrentTCB->uxPriority )
+                {
+                    xSwitchRequired = pdTRUE;
+                }
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return xSwitchRequired;
+    }
+#endif
+
+/*-----------------------------------------------------------*/
+
+#if( INCLUDE_xTaskCreateTimed == 1 )
+    static void prvReleaseTimedJob( TCB_t * const pxTCB )
+    {
+        /* Job is late if the previous one ended after this was due */
+        const TickType_t xJitter = xTickCount - pxTCB->xReleaseTick;
+
+        pxTCB->ucJobState = tskJOB_RELEASED;
+
+        #if( configUSE_TIMED_TASK_STATS == 1 )
+        {
+            pxTCB->ulReleaseRunTime = portGET_RUN_TIME_COUNTER_VALUE();
+            pxTCB->ulJobLatency = 0;
+
+            if( xJitter > pxTCB->ulStatsJitterMax )
+            {
+                pxTCB->ulStatsSequence++;
+                pxTCB->ulStatsJitterMax = xJitter;
+                pxTCB->ulStatsSequence++;
+            }
+        }
+        #endif
+
+        if( pxTCB->xOverflowTimer != NULL )
+        {
+            /* Deadline counts from the tick the job was due */
+            prvStartOverflowTracking( pxTCB );
+            pxTCB->xOverflowStartTick = pxTCB->xReleaseTick;
+
+            if( xJitter != ( TickType_t ) 0 )
+            {
+                xTicksToOverflowCheck = 1;
+            }
+        }
+    }
+#endif
+
+/*-----------------------------------------------------------*/
+
+#if( INCLUDE_xTaskCreateTimed == 1 )
+    static void prvCompleteTimedJob( TCB_t * const pxTCB )
+    {
+        #if( configUSE_TIMED_TASK_STATS == 1 )
+        {
+            const uint32_t ulResponse = portGET_RUN_TIME_COUNTER_VALUE() - pxTCB->ulReleaseRunTime;
+            TickType_t xDeadline = pxTCB->xPeriod;
+
+            if( pxTCB->xOverflowTimer != NULL )
+            {
+                xDeadline = pxTCB->xOverflowTicksMax;
+            }
+
+            prvRecordTimedJob( pxTCB );
+
+            pxTCB->ulStatsSequence++;
+
+            if( ( TickType_t ) ( xTickCount - pxTCB->xReleaseTick ) > xDeadline )
+            {
+                pxTCB->ulStatsDeadlineMisses++;
+            }
+
+            pxTCB->ullStatsLatencyTotal += pxTCB->ulJobLatency;
+            pxTCB->ullStatsResponseTotal += ulResponse;
+
+            if( pxTCB->ulJobLatency > pxTCB->ulStatsLatencyMax )
+            {
+                pxTCB->ulStatsLatencyMax = pxTCB->ulJobLatency;
+            }
+
+            if( ulResponse > pxTCB->ulStatsResponseMax )
+            {
+                pxTCB->ulStatsResponseMax = ulResponse;
+            }
+
+            pxTCB->ulStatsSequence++;
+        }
+        #endif
+
+        /* Overflow time counts again from the next release */
+        if( listLIST_ITEM_CONTAINER( &( pxTCB->xOverflowListItem ) ) != NULL )
+        {
+            ( void ) uxListRemove( &( pxTCB->xOverflowListItem ) );
+        }
+
+        if( ( pxTCB->xOverrunTimer != NULL ) &&
+            ( pxTCB->ucEnforcement == ( uint8_t ) eTimedEnforceNone ) )
+        {
+            prvRestartOverrunTime( pxTCB );
+        }
+    }
+#endif
+
+/*-----------------------------------------------------------*/
+
+eTaskType eTaskGetType( TaskHandle_t pxTaskHandle )
+{
+    TCB_t * pxTCB = prvGetTCBFromHandle( pxTaskHandle );
+    configASSERT( pxTCB );
+    return pxTCB->eType;
+}
+
+/*-----------------------------------------------------------*/
+
+#if( INCLUDE_xTaskCreateReplicated == 1 )
+
+    BaseType_t xTaskCreateReplicated( TaskFunction_t pxTaskCode,
+                            const char * const pcName,
+                            const configSTACK_DEPTH_TYPE usStackDepth,
+                            void * const pvParameters,
+                            UBaseType_t uxPriority,
+                            TaskHandle_t * const pxCreatedTask,
+                            uint8_t ucReplicatedType,
+                            RedundantValueErrorCb_t pxRedundantValueErrorCb )
+    {
+        return prvCreateReplicatedGroup( pxTaskCode,
+                                         pcName,
+                                         usStackDepth,
+                                         pvParameters,
+                                         uxPriority,
+                                         pxCreatedTask,
+                                         ucReplicatedType,
+                                         0,
+                                         NULL,
+                                         NULL,
+                                         NULL,
+                                         pxRedundantValueErrorCb );
+    }
+#endif
+
+/*-----------------------------------------------------------*/
+
+#if( ( INCLUDE_xTaskCreateReplicated == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) )
+
+    BaseType_t xTaskCreateReplicatedStatic( TaskFunction_t pxTaskCode,
+                            const char * const pcName,
+                            const uint32_t ulStackDepth,
+                            void * const pvParameters,
+                            UBaseType_t uxPriority,
+                            TaskHandle_t * const pxCreatedTask,
+                            uint8_t ucReplicatedType,
+                            StackType_t * const puxStackBuffers,
+                            StaticTask_t * const pxTaskBuffers,
+                            StaticReplicatedGroup_t * const pxGroupBuffer,
+                            RedundantValueErrorCb_t pxRedundantValueErrorCb )
+    {
+        configASSERT( puxStackBuffers != NULL );
+        configASSERT( pxTaskBuffers != NULL );
+        configASSERT( pxGroupBuffer != NULL );
+
+        #if( configASSERT_DEFINED == 1 )
+        {
+            /* Sanity check that the size of the structure used to declare a
+            variable of type StaticReplicatedGroup_t equals the size of the
+            real group structure. */
+            volatile size_t xSize = sizeof( StaticReplicatedGroup_t );
+            configASSERT( xSize == sizeof( ReplicatedGroup_t ) );
+        }
+        #endif /* configASSERT_DEFINED */
+
+        return prvCreateReplicatedGroup( pxTaskCode,
+                                         pcName,
+                                         ulStackDepth,
+                                         pvParameters,
+                                         uxPriority,
+                                         pxCreatedTask,
+                                         ucReplicatedType,
+                                         0,
+                                         puxStackBuffers,
+                                         pxTaskBuffers,
+                                         pxGroupBuffer,
+                                         pxRedundantValueErrorCb );
+    }
+#endif
+
+/*-----------------------------------------------------------*/
+
+#if( INCLUDE_xTaskCreateReplicated == 1 )
+
+    BaseType_t xTaskCreateReplicatedPipelined( TaskFunction_t pxTaskCode,
+                            const char * const pcName,
+                            const configSTACK_DEPTH_TYPE usStackDepth,
+                            void * const pvParameters,
+                            UBaseType_t uxPriority,
+                            TaskHandle_t * const pxCreatedTask,
+                            uint8_t ucReplicatedType,
+                            UBaseType_t uxSkew,
+                            RedundantValueErrorCb_t pxRedundantValueErrorCb )
+    {
+        /* Pipelined replicas never wait for each other */
+        configASSERT( ( ucReplicatedType & taskREPLICATED_EARLY_RELEASE ) == 0 );
+        configASSERT( uxSkew > 0 );
+
+        return prvCreateReplicatedGroup( pxTaskCode,
+                                         pcName,
+                                         usStackDepth,
+                                         pvParameters,
+                                         uxPriority,
+                                         pxCreatedTask,
+                                         ucReplicatedType,
+                                         uxSkew,
+                                         NULL,
+                                         NULL,
+                                         NULL,
+                                         pxRedundantValueErrorCb );
+    }
+#endif
+
+/*-----------------------------------------------------------*/
+
+#if( INCLUDE_xTaskCreateReplicated == 1 )
+
+    static BaseType_t prvCreateReplicatedGroup( TaskFunction_t pxTaskCode,
+                                                const char * const pcName,
+                                                const uint32_t ulStackDepth,
+                                                void * const pvParameters,
+                                                UBaseType_t uxPriority,
+                                                TaskHandle_t * const pxCreatedTask,
+                                                uint8_t ucReplicatedType,
+                                                UBaseType_t uxSkew,
+                                                StackType_t * const puxStackBuffers,
+                                                StaticTask_t * const pxTaskBuffers,
+                                                StaticReplicatedGroup_t * const pxGroupBuffer,
+                                                RedundantValueErrorCb_t pxRedundantValueErrorCb )
+    {
+        BaseType_t xReturn = pdPASS;
+        TaskHandle_t pxInternalTaskHandle = NULL;
+        ReplicatedGroup_t * pxGroup;
+        StackType_t * puxStacks = puxStackBuffers;
+        StaticTask_t * pxTCBs = pxTaskBuffers;
+        uint8_t ucAllocation = tskSTATICALLY_ALLOCATED_STACK_AND_TCB;
+
+        BaseType_t xEarlyRelease = pdFALSE;
+
+        if( ( ucReplicatedType & taskREPLICATED_EARLY_RELEASE ) != 0 )
+        {
+            xEarlyRelease = pdTRUE;
+            ucReplicatedType &= ( uint8_t ) ~taskREPLICATED_EARLY_RELEASE;
+
+            /* Early release needs a majority that is smaller than the group */
+            configASSERT( ucReplicatedType >= taskREPLICATED_RECOVERY );
+        }
+
+        /* ucReplicatedType is the number of replicas in the group.
+         * taskREPLICATED_NO_RECOVERY and taskREPLICATED_RECOVERY are kept as
+         * names for groups of two and three tasks. */
+        configASSERT( ( ucReplicatedType >= taskREPLICATED_NO_RECOVERY ) &&
+                      ( ucReplicatedType <= configMAX_REPLICATED_TASKS ) );
+        configASSERT( pxRedundantValueErrorCb );
+
+        if( pxGroupBuffer != NULL )
+        {
+            /* Static groups are lockstep only, rings would need memory */
+            configASSERT( uxSkew == 0 );
+            pxGroup = ( ReplicatedGroup_t * ) pxGroupBuffer; /*lint !e740 Unusual cast is ok as the structures are designed to have the same alignment, and the size is checked by an assert. */
+        }
+        else
+        {
+            /* Group, rings of pipelined groups, TCBs and stacks of all
+             * replicas are allocated as one block. Group is at the start, so
+             * freeing the group frees the block. */
+            const size_t xGroupSize = tskREPLICATED_ALIGN( sizeof( ReplicatedGroup_t ) +
+                                                           ( sizeof( CompareValue_t ) * uxSkew * ucReplicatedType ) );
+            const size_t xTCBsSize = tskREPLICATED_ALIGN( sizeof( TCB_t ) ) * ucReplicatedType;
+            const size_t xStacksSize = tskREPLICATED_ALIGN( ulStackDepth * sizeof( StackType_t ) ) * ucReplicatedType;
+            uint8_t * pucBlock = ( uint8_t * ) pvPortMalloc( xGroupSize + xTCBsSize + xStacksSize );
+
+            if( pucBlock == NULL )
+            {
+                return errCOULD_NOT_ALLOCATE_REQUIRED_MEMORY;
+            }
+
+            pxGroup = ( ReplicatedGroup_t * ) pucBlock;
+
+            /* Same order as in prvTaskCreateGeneric(), so stacks can't grow
+             * into the TCBs */
+            #if( portSTACK_GROWTH > 0 )
+            {
+                pxTCBs = ( StaticTask_t * ) ( pucBlock + xGroupSize );
+                puxStacks = ( StackType_t * ) ( pucBlock + xGroupSize + xTCBsSize );
+            }
+            #else /* portSTACK_GROWTH */
+            {
+                puxStacks = ( StackType_t * ) ( pucBlock + xGroupSize );
+                pxTCBs = ( StaticTask_t * ) ( pucBlock + xGroupSize + xStacksSize );
+            }
+            #endif /* portSTACK_GROWTH */
+
+            ucAllocation = tskGROUP_ALLOCATED_STACK_AND_TCB;
+        }
+
+        ( void ) memset( ( void * ) pxGroup, 0x00, sizeof( ReplicatedGroup_t ) );
+        vListInitialise( &( pxGroup->xSyncWaitList ) );
+
+        if( pxGroupBuffer != NULL )
+        {
+            pxGroup->ucStaticallyAllocated = pdTRUE;
+        }
+
+        if( uxSkew > 0 )
+        {
+            pxGroup->uxSkew = uxSkew;
+            pxGroup->pxRings = ( CompareValue_t * ) ( pxGroup + 1 );
+        }
+
+        pxGroup->pxTaskCode = pxTaskCode;
+        pxGroup->usStackDepth = ( configSTACK_DEPTH_TYPE ) ulStackDepth;
+        pxGroup->pvParameters = pvParameters;
+        pxGroup->uxPriority = uxPriority;
+        pxGroup->xEarlyRelease = xEarlyRelease;
+
+        /* Make sure all tasks are created before tasks are switched into */
+        taskENTER_CRITICAL();
+
+        for( uint8_t iii = 0; iii < ucReplicatedType; iii++ )
+        {
+            /* Memory is already there, so creating a replica can't fail */
+            ( void ) prvTaskCreateStaticGeneric( pxTaskCode,
+                                                 pcName,
+                                                 ulStackDepth,
+                                                 pvParameters,
+                                                 uxPriority,
+                                                 &pxInternalTaskHandle,
+                                                 puxStacks,
+                                                 pxTCBs,
+                                                 ucAllocation,
+                                                 eReplicated,
+                                                 0,
+                                                 NULL,
+                                                 NULL,
+                                                 0,
+                                                 NULL,
+                                                 NULL,
+                                                 pxRedundantValueErrorCb );
+
+            prvAddReplicaToGroup( pxGroup, pxInternalTaskHandle );
+
+            if( pxGroupBuffer != NULL )
+            {
+                /* Replica n uses TCB n and the n-th stack of the caller's
+                 * arrays */
+                puxStacks += ulStackDepth;
+                pxTCBs++;
+            }
+            else
+            {
+                puxStacks = ( StackType_t * ) ( ( uint8_t * ) puxStacks +
+                                                tskREPLICATED_ALIGN( ulStackDepth * sizeof( StackType_t ) ) );
+                pxTCBs = ( StaticTask_t * ) ( ( uint8_t * ) pxTCBs + tskREPLICATED_ALIGN( sizeof( TCB_t ) ) );
+                pxGroup->uxBlockTasks++;
+            }
+        }
+
+        if( pxCreatedTask != NULL )
+        {
+            /* If task handle to return is NULL we don't have to fill it,
+             * but as it isn't NULL we fill it with one of the created tasks */
+            *pxCreatedTask  = pxGroup->pxReplicas[ 0 ];
+        }
+
+        taskEXIT_CRITICAL();
+
+        return xReturn;
+    }
+#endif
+
+/*-----------------------------------------------------------*/
+
+#if( INCLUDE_xTaskCreateReplicated == 1 )
+    static void prvAddReplicaToGroup( ReplicatedGroup_t * const pxGroup,
+                                      TaskHandle_t const pxTaskHandle )
+    {
+        TCB_t * pxTCB = prvGetTCBFromHandle( pxTaskHandle );
+        uint8_t ucIndex;
+
+        configASSERT( pxTCB );
+        configASSERT( pxGroup );
+        configASSERT( pxGroup->ucNumOfReplicas < configMAX_REPLICATED_TASKS );
+
+        ucIndex = pxGroup->ucNumOfReplicas;
+
+        pxTCB->pxReplicatedGroup = pxGroup;
+        pxTCB->ucReplicaIndex = ucIndex;
+
+        pxGroup->pxReplicas[ ucIndex ] = pxTCB;
+        pxGroup->ulMembersMask |= ( ( uint32_t ) 1UL ) << ucIndex;
+        pxGroup->ucNumOfReplicas++;
+    }
+#endif
+
+/*-----------------------------------------------------------*/
+
+#if( INCLUDE_xTaskCreateReplicated == 1 )
+    void vTaskSyncAndCompare( const CompareValue_t * const pxNewCompareValue )
+    {
+        TCB_t * pxTCB = prvGetTCBFromHandle( NULL );
+        ReplicatedGroup_t * pxGroup;
+
+        configASSERT( pxTCB );
         configASSERT( eReplicated == pxTCB->eType );
 
+        pxGroup = pxTCB->pxReplicatedGroup;
+        configASSERT( pxGroup );
+
         if( pxNewCompareValue != NULL )
         {
             pxTCB->xCompareValue = *pxNewCompareValue;
         }
 
-        taskENTER_CRITICAL();
+        if( pxGroup->uxSkew > 0 )
+        {
+            CompareValue_t xPushedValue = pxTCB->xCompareValue;
+
+            if( pxTCB->uxCheckpoints > 0 )
+            {
+                /* Ring holds one value per round, so recorded checkpoints
+                 * are folded into the pushed value, followed by the value
+                 * of the synchronization point */
+                xPushedValue = ulCompareDigestUpdate( digestINITIAL_VALUE,
+                                                      ( const void * ) pxTCB->xCheckpoints,
+                                                      pxTCB->uxCheckpoints * sizeof( CompareValue_t ) );
+                xPushedValue = ulCompareDigestUpdate( xPushedValue,
+                                                      ( const void * ) &( pxTCB->xCompareValue ),
+                                                      sizeof( CompareValue_t ) );
+                pxTCB->uxCheckpoints = 0;
+            }
+
+            prvSyncPipelined( pxTCB, pxGroup, xPushedValue );
+            return;
+        }
+
+        taskENTER_CRITICAL();
+
+        switch( prvMarkReplicaArrived( pxTCB ) )
+        {
+            case replicatedLAST:
+            {
+                taskEXIT_CRITICAL();
+
+                prvCompareAllReplicas( pxTCB, pxGroup );
+            }
+            break;
+
+            case replicatedEARLY:
+            {
+                taskEXIT_CRITICAL();
+
+                /* Arrived replicas agree, the rest is compared when it
+                 * arrives */
+                pxGroup->xMismatch.ulDivergedMask = 0;
+                prvUnblockReplicatedTasks( pxGroup );
+            }
+            break;
+
+            case replicatedLATE:
+            {
+                taskEXIT_CRITICAL();
+
+                /* Round of this replica is already released, it doesn't
+                 * wait */
+                prvCompareLateReplica( pxTCB, pxGroup );
+            }
+            break;
+
+            default:
+            {
+                /* Task was not last to arrive so wait on the group's event
+                 * list. Task is placed on the list before leaving the
+                 * critical section, so the last replica can't miss it. The
+                 * context switch is pended until the critical section is
+                 * exited. */
+                vTaskPlaceOnEventList( &( pxGroup->xSyncWaitList ), portMAX_DELAY );
+                portYIELD_WITHIN_API();
+
+                taskEXIT_CRITICAL();
+            }
+            break;
+        }
+
+        /* Checkpoints of the round were compared before the replica was
+         * released */
+        pxTCB->uxCheckpoints = 0;
+    }
+#endif
+
+/*-----------------------------------------------------------*/
+
+#if( INCLUDE_xTaskCreateReplicated == 1 )
+    static void prvCompareAllReplicas( TCB_t * pxTCB, ReplicatedGroup_t * pxGroup )
+    {
+        /* All other replicas are waiting on the synchronization point, so
+         * their compare values can be read without further locking */
+        uint8_t ucIsDeleteRequest = pdFALSE;
+        BaseType_t xIsDeletingSelf = pdFALSE;
+        CompareValue_t pxCompareValues[ configMAX_REPLICATED_TASKS ];
+        UBaseType_t uxCheckpoints = 0;
+
+        pxGroup->xMismatch.ulDivergedMask = 0;
+
+        if( pxGroup->xRoundAgrees != pdFALSE )
+        {
+            /* Every replica agreed with the first arrived one, values only
+             * need to be collected if the group is respawned */
+            uxCheckpoints = pxTCB->uxCheckpoints;
+
+            if( pxGroup->ulRespawnMask != 0 )
+            {
+                prvGetCompareValues( pxGroup, pxCompareValues, uxCheckpoints );
+            }
+        }
+        else
+        {
+            for( uint8_t iii = 0; iii < pxGroup->ucNumOfReplicas; iii++ )
+            {
+                if( pxGroup->pxReplicas[ iii ]->uxCheckpoints > uxCheckpoints )
+                {
+                    uxCheckpoints = pxGroup->pxReplicas[ iii ]->uxCheckpoints;
+                }
+            }
+        }
+
+        /* Checkpoints are compared in order, followed by the value of the
+         * synchronization point. Only the first diverged one is reported. */
+        for( UBaseType_t uxCheckpoint = 0;
+             ( pxGroup->xRoundAgrees == pdFALSE ) &&
+             ( uxCheckpoint <= uxCheckpoints ) &&
+             ( pxGroup->xMismatch.ulDivergedMask == 0 );
+             uxCheckpoint++ )
+        {
+            prvGetCompareValues( pxGroup, pxCompareValues, uxCheckpoint );
+
+            for( uint8_t iii = 1; iii < pxGroup->ucNumOfReplicas; iii++ )
+            {
+                if( pxCompareValues[ iii ] != pxCompareValues[ 0 ] )
+                {
+                    prvRecordMismatch( pxGroup, pxCompareValues, pxGroup->ulSyncCount - 1, uxCheckpoint );
+
+                    ucIsDeleteRequest = pxTCB->pxRedundantValueErrorCb(
+                                                      pxCompareValues,
+                                                      pxGroup->ucNumOfReplicas );
+                    break;
+                }
+            }
+        }
+
+        if( ( pxGroup->ulRespawnMask != 0 ) && ( pdTRUE != ucIsDeleteRequest ) )
+        {
+            /* Respawn was requested for a late replica, now it can be done
+             * as every replica is on the synchronization point */
+            if( pxGroup->xMismatch.ulDivergedMask == 0 )
+            {
+                prvRecordMismatch( pxGroup, pxCompareValues, pxGroup->ulSyncCount - 1, uxCheckpoints );
+            }
+
+            pxGroup->xMismatch.ulDivergedMask |= pxGroup->ulRespawnMask;
+            ucIsDeleteRequest = taskREPLICATED_RESPAWN;
+        }
+
+        if( taskREPLICATED_RESPAWN == ucIsDeleteRequest )
+        {
+            /* Without a majority there is no correct state to copy,
+             * delete all replicated tasks instead */
+            if( prvRespawnDivergedReplicas( pxGroup, &xIsDeletingSelf ) == pdFAIL )
+            {
+                ucIsDeleteRequest = pdTRUE;
+            }
+            else
+            {
+                pxGroup->ulRespawnMask = 0;
+            }
+        }
+
+        if( pdTRUE == ucIsDeleteRequest )
+        {
+            /* Delete is requested from mismatch callback, delete all
+             * replicated tasks. Calling task may already be replaced, so
+             * the group is deleted through its first replica. */
+            vTaskDelete( pxGroup->pxReplicas[ 0 ] );
+        }
+        else if( xIsDeletingSelf != pdFALSE )
+        {
+            /* Calling replica diverged. It is removed together with the
+             * unblocking, so no other replica sees it half replaced, and the
+             * idle task respawns it in its TCB and stack once it is off its
+             * stack. */
+            taskENTER_CRITICAL();
+            {
+                prvUnblockReplicatedTasks( pxGroup );
+
+                pxGroup->ulIdleRespawnMask |= ( ( uint32_t ) 1UL ) << pxTCB->ucReplicaIndex;
+                ( void ) prvRemoveTask( pxTCB );
+                portYIELD_WITHIN_API();
+            }
+            taskEXIT_CRITICAL();
+        }
+        else
+        {
+            /* Delete was not requested */
+            prvUnblockReplicatedTasks( pxGroup );
+        }
+    }
+#endif
+
+/*-----------------------------------------------------------*/
+
+#if( INCLUDE_xTaskCreateReplicated == 1 )
+    static void prvCompareLateReplica( TCB_t * pxTCB, ReplicatedGroup_t * pxGroup )
+    {
+        uint8_t ucIsDeleteRequest;
+        CompareValue_t pxCompareValues[ configMAX_REPLICATED_TASKS ];
+        CompareValue_t xAgreedValue = pxGroup->xAgreedValue;
+        UBaseType_t uxCheckpoints = pxGroup->uxAgreedCheckpoints;
+        UBaseType_t uxCheckpoint;
+
+        if( pxTCB->uxCheckpoints > uxCheckpoints )
+        {
+            uxCheckpoints = pxTCB->uxCheckpoints;
+        }
+
+        /* Agreed checkpoints are padded with the agreed value, like
+         * prvGetCheckpoint() does for replicas */
+        for( uxCheckpoint = 0; uxCheckpoint <= uxCheckpoints; uxCheckpoint++ )
+        {
+            xAgreedValue = ( uxCheckpoint < pxGroup->uxAgreedCheckpoints ) ?
+                           pxGroup->xAgreedCheckpoints[ uxCheckpoint ] : pxGroup->xAgreedValue;
+
+            if( prvGetCheckpoint( pxTCB, uxCheckpoint ) != xAgreedValue )
+            {
+                break;
+            }
+        }
+
+        if( uxCheckpoint > uxCheckpoints )
+        {
+            return;
+        }
+
+        /* Other replicas already continued, the callback gets the values of
+         * the released round */
+        for( uint8_t iii = 0; iii < pxGroup->ucNumOfReplicas; iii++ )
+        {
+            pxCompareValues[ iii ] = xAgreedValue;
+        }
+
+        pxCompareValues[ pxTCB->ucReplicaIndex ] = prvGetCheckpoint( pxTCB, uxCheckpoint );
+
+        taskENTER_CRITICAL();
+        {
+            pxGroup->xMismatch.ulDivergedMask = ( ( uint32_t ) 1UL ) << pxTCB->ucReplicaIndex;
+            pxGroup->xMismatch.xVotedValue = xAgreedValue;
+            pxGroup->xMismatch.ucVotes = pxGroup->ucAgreedVotes;
+            pxGroup->xMismatch.ulSyncIndex = pxGroup->ulSyncCount - 1;
+            pxGroup->xMismatch.uxCheckpoint = uxCheckpoint;
+        }
+        taskEXIT_CRITICAL();
+
+        ucIsDeleteRequest = pxTCB->pxRedundantValueErrorCb( pxCompareValues,
+                                                            pxGroup->ucNumOfReplicas );
+
+        if( pdTRUE == ucIsDeleteRequest )
+        {
+            vTaskDelete( pxGroup->pxReplicas[ 0 ] );
+        }
+        else if( taskREPLICATED_RESPAWN == ucIsDeleteRequest )
+        {
+            /* State of other replicas can't be copied while they run, respawn
+             * is done on the next round every replica arrives on. Early
+             * release is disabled until then. */
+            taskENTER_CRITICAL();
+            {
+                pxGroup->ulRespawnMask |= ( ( uint32_t ) 1UL ) << pxTCB->ucReplicaIndex;
+            }
+            taskEXIT_CRITICAL();
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+#endif
+
+/*-----------------------------------------------------------*/
+
+#if( INCLUDE_xTaskCreateReplicated == 1 )
+    static void prvSyncPipelined( TCB_t * pxTCB,
+                                  ReplicatedGroup_t * pxGroup,
+                                  CompareValue_t xCompareValue )
+    {
+        const uint8_t ucIndex = pxTCB->ucReplicaIndex;
+        CompareValue_t pxCompareValues[ configMAX_REPLICATED_TASKS ];
+        uint32_t ulCompleted;
+        uint8_t ucIsDeleteRequest;
+
+        for( ;; )
+        {
+            taskENTER_CRITICAL();
+
+            if( ( pxGroup->ulPushed[ ucIndex ] - pxGroup->ulSyncCount ) < ( uint32_t ) pxGroup->uxSkew )
+            {
+                break;
+            }
+
+            /* Ring is full, wait until the voter frees an entry. Critical
+             * section is left with the task on the list, so the voter can't
+             * miss it. */
+            vTaskPlaceOnEventList( &( pxGroup->xSyncWaitList ), portMAX_DELAY );
+            portYIELD_WITHIN_API();
+
+            taskEXIT_CRITICAL();
+        }
+
+        pxGroup->pxRings[ ( ucIndex * pxGroup->uxSkew ) +
+                          ( pxGroup->ulPushed[ ucIndex ] % pxGroup->uxSkew ) ] = xCompareValue;
+        pxGroup->ulPushed[ ucIndex ]++;
+
+        for( ;; )
+        {
+            /* Rounds every replica pushed can be compared */
+            ulCompleted = pxGroup->ulPushed[ 0 ];
+
+            for( uint8_t iii = 1; iii < pxGroup->ucNumOfReplicas; iii++ )
+            {
+                if( ( pxGroup->ulPushed[ iii ] - pxGroup->ulSyncCount ) <
+                    ( ulCompleted - pxGroup->ulSyncCount ) )
+                {
+                    ulCompleted = pxGroup->ulPushed[ iii ];
+                }
+            }
+
+            if( ( pxGroup->xIsVoting != pdFALSE ) || ( ulCompleted == pxGroup->ulSyncCount ) )
+            {
+                /* Nothing to compare, or other replica is comparing and will
+                 * pick up the rounds completed meanwhile */
+                taskEXIT_CRITICAL();
+                break;
+            }
+
+            pxGroup->xIsVoting = pdTRUE;
 
-        if( prvIsLastArrivedRedundantTask( pxTCB ) == pdTRUE )
-        {
             taskEXIT_CRITICAL();
-            uint8_t ucIsDeleteRequest = pdFALSE;
-            if( prvIsCompareValueSame( pxTCB )  == pdFALSE )
+
+            /* Entries up to ulCompleted can't be overwritten before
+             * ulSyncCount passes them, so they are read without locking */
+            for( uint32_t ulSync = pxGroup->ulSyncCount; ulSync != ulCompleted; ulSync++ )
             {
-                CompareValue_t pxCompareValues[taskREPLICATED_RECOVERY];
+                for( uint8_t iii = 0; iii < pxGroup->ucNumOfReplicas; iii++ )
+                {
+                    pxCompareValues[ iii ] = pxGroup->pxRings[ ( iii * pxGroup->uxSkew ) +
+                                                               ( ulSync % pxGroup->uxSkew ) ];
+                }
 
-                prvGetCompareValues( pxTCB, pxCompareValues,
-                                     pxTCB->ucReplicatedTaskType );
+                if( ucTaskVoteCompareValues( pxCompareValues, pxGroup->ucNumOfReplicas, NULL ) ==
+                    pxGroup->ucNumOfReplicas )
+                {
+                    continue;
+                }
 
-                ucIsDeleteRequest = pxTCB->pxRedundantValueErrorCb(
-                                                  pxCompareValues,
-                                                  pxTCB->ucReplicatedTaskType );
-            }
+                /* Minority is recorded in xMismatch.ulDivergedMask */
+                prvRecordMismatch( pxGroup, pxCompareValues, ulSync, 0 );
 
-            if( pdTRUE == ucIsDeleteRequest )
-            {
-                /* Delete is requested from mismatch callback, delete all
-                 * replicated tasks */
-                vTaskDelete( pxTCB );
+                ucIsDeleteRequest = pxTCB->pxRedundantValueErrorCb( pxCompareValues,
+                                                                    pxGroup->ucNumOfReplicas );
+
+                /* State of running replicas can't be copied, so respawn lets
+                 * the majority mask the diverged replicas. Without a
+                 * majority the group is deleted. */
+                if( ( pdTRUE == ucIsDeleteRequest ) ||
+                    ( ( taskREPLICATED_RESPAWN == ucIsDeleteRequest ) &&
+                      ( ( ( uint32_t ) pxGroup->xMismatch.ucVotes * 2UL ) <= ( uint32_t ) pxGroup->ucNumOfReplicas ) ) )
+                {
+                    vTaskDelete( pxGroup->pxReplicas[ 0 ] );
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
             }
-            else
+
+            taskENTER_CRITICAL();
+
+            pxGroup->ulSyncCount = ulCompleted;
+            pxGroup->xIsVoting = pdFALSE;
+
+            /* Entries are free again, wake replicas with full rings */
+            while( listLIST_IS_EMPTY( &( pxGroup->xSyncWaitList ) ) == pdFALSE )
             {
-                /* Delete was not requested */
-                prvUnblockReplicatedTasks( pxTCB );
+                if( xTaskRemoveFromEventList( &( pxGroup->xSyncWaitList ) ) != pdFALSE )
+                {
+                    portYIELD_WITHIN_API();
+                }
             }
         }
-        else
-        {
-            /* Task was not last to arrive so signal it is waiting on compare
-             * and suspend it */
-            pxTCB->ucIsWaitingOnCompare = pdTRUE;
-
-            taskEXIT_CRITICAL();
-            vTaskSuspend(NULL);
-        }
     }
 #endif
 
@@ -5675,266 +8476,555 @@ eTaskType eTaskGetType( TaskHandle_t pxTaskHandle )
 /*-----------------------------------------------------------*/
 
 #if( INCLUDE_xTaskCreateReplicated == 1 )
-    static void prvUnblockReplicatedTasks( TCB_t * pxStartTCB )
+    BaseType_t xTaskRecordCompareValue( CompareValue_t xCompareValue )
     {
-        TCB_t * pxWorkTCB;
+        TCB_t * pxTCB = prvGetTCBFromHandle( NULL );
 
-        configASSERT( pxStartTCB );
-        configASSERT( pxStartTCB->pxNextTaskHandle );
-        configASSERT( pxStartTCB->eType == eReplicated );
+        configASSERT( pxTCB );
+        configASSERT( eReplicated == pxTCB->eType );
+        configASSERT( pxTCB->pxReplicatedGroup );
+
+        if( pxTCB->uxCheckpoints >= ( UBaseType_t ) configMAX_REPLICATED_CHECKPOINTS )
+        {
+            return pdFAIL;
+        }
 
-        pxWorkTCB = pxStartTCB->pxNextTaskHandle;
+        /* Only the calling replica writes its checkpoints and they are read
+         * by others only while it waits on the synchronization point */
+        pxTCB->xCheckpoints[ pxTCB->uxCheckpoints ] = xCompareValue;
+        pxTCB->uxCheckpoints++;
 
-        /* Make sure all tasks are resumed before tasks are switched into */
-        taskENTER_CRITICAL();
+        return pdPASS;
+    }
+#endif
+/*-----------------------------------------------------------*/
 
-        while( pxWorkTCB != pxStartTCB )
+#if( INCLUDE_xTaskCreateReplicated == 1 )
+    static BaseType_t prvReplicasAgree( const TCB_t * const pxTCB, const TCB_t * const pxOtherTCB )
+    {
+        if( ( pxTCB->xCompareValue != pxOtherTCB->xCompareValue ) ||
+            ( pxTCB->uxCheckpoints != pxOtherTCB->uxCheckpoints ) ||
+            ( memcmp( ( const void * ) pxTCB->xCheckpoints,
+                      ( const void * ) pxOtherTCB->xCheckpoints,
+                      pxTCB->uxCheckpoints * sizeof( CompareValue_t ) ) != 0 ) )
         {
-            vTaskResume( pxWorkTCB );
-
-            pxWorkTCB->ucIsWaitingOnCompare = pdFALSE;
-            pxWorkTCB = pxWorkTCB->pxNextTaskHandle;
-            configASSERT( pxWorkTCB );
+            return pdFALSE;
         }
 
-        taskEXIT_CRITICAL();
+        return pdTRUE;
     }
 #endif
-
 /*-----------------------------------------------------------*/
 
 #if( INCLUDE_xTaskCreateReplicated == 1 )
-    static void prvGetCompareValues( TCB_t * pxTCB,
-                                        CompareValue_t * xCompareValues,
-                                        uint8_t ucValuesLen )
+    static CompareValue_t prvGetCheckpoint( const TCB_t * const pxTCB, UBaseType_t uxCheckpoint )
     {
-        TCB_t * pxWorkTCB = pxTCB;
+        if( uxCheckpoint < pxTCB->uxCheckpoints )
+        {
+            return pxTCB->xCheckpoints[ uxCheckpoint ];
+        }
 
-        configASSERT( pxTCB );
+        return pxTCB->xCompareValue;
+    }
+#endif
+/*-----------------------------------------------------------*/
+
+#if( INCLUDE_xTaskCreateReplicated == 1 )
+    uint8_t ucTaskVoteCompareValues( const CompareValue_t * const pxCompareValues,
+                                     const uint8_t ucValuesLen,
+                                     CompareValue_t * const pxVotedValue )
+    {
+        uint8_t ucBestVotes = 0;
+        uint8_t ucBestIndex = 0;
 
-        /* WARNING: Shall be called when scheduler is stopped */
+        configASSERT( pxCompareValues );
+        configASSERT( ucValuesLen > 0 );
 
         for( uint8_t iii = 0; iii < ucValuesLen; iii++ )
         {
-            xCompareValues[iii] = pxWorkTCB->xCompareValue;
+            uint8_t ucVotes = 0;
+
+            /* Stop when no remaining value could get more votes */
+            if( ( uint8_t ) ( ucValuesLen - iii ) <= ucBestVotes )
+            {
+                break;
+            }
+
+            for( uint8_t jjj = iii; jjj < ucValuesLen; jjj++ )
+            {
+                if( pxCompareValues[ jjj ] == pxCompareValues[ iii ] )
+                {
+                    ucVotes++;
+                }
+            }
+
+            if( ucVotes > ucBestVotes )
+            {
+                ucBestVotes = ucVotes;
+                ucBestIndex = iii;
+            }
+        }
 
-            configASSERT( pxWorkTCB->pxNextTaskHandle );
-            pxWorkTCB = ( TCB_t * ) pxWorkTCB->pxNextTaskHandle;
+        if( pxVotedValue != NULL )
+        {
+            *pxVotedValue = pxCompareValues[ ucBestIndex ];
         }
+
+        return ucBestVotes;
     }
 #endif
-
 /*-----------------------------------------------------------*/
 
 #if( INCLUDE_xTaskCreateReplicated == 1 )
-    static uint8_t prvIsCompareValueSame( TCB_t * pxTCB )
+    static void prvUnblockReplicatedTasks( ReplicatedGroup_t * const pxGroup )
     {
-        TCB_t * pxStartTCB = pxTCB;
-        TCB_t * pxWorkTCB = pxTCB;
+        BaseType_t xYieldRequired = pdFALSE;
 
-        configASSERT( pxTCB );
-        configASSERT( pxWorkTCB->pxNextTaskHandle );
+        configASSERT( pxGroup );
 
-        pxWorkTCB = ( TCB_t * ) pxWorkTCB->pxNextTaskHandle;
+        /* Make sure all tasks are ready before tasks are switched into */
+        taskENTER_CRITICAL();
 
-        while( pxWorkTCB != pxStartTCB )
+        while( listLIST_IS_EMPTY( &( pxGroup->xSyncWaitList ) ) == pdFALSE )
         {
-            /* If task is stuck in this loop pxNextTaskHandle isn't set up
-             * correctly on all replicated tasks, they should be arranged in
-             * a ring */
-
-            if( pxStartTCB->xCompareValue != pxWorkTCB->xCompareValue )
+            if( xTaskRemoveFromEventList( &( pxGroup->xSyncWaitList ) ) != pdFALSE )
             {
-                /* Compare values are different, raise error */
-                return pdFALSE;
+                xYieldRequired = pdTRUE;
             }
+        }
 
-            configASSERT( pxWorkTCB->pxNextTaskHandle );
-            pxWorkTCB = ( TCB_t * ) pxWorkTCB->pxNextTaskHandle;
+        if( xYieldRequired != pdFALSE )
+        {
+            portYIELD_WITHIN_API();
         }
 
+        taskEXIT_CRITICAL();
+    }
+#endif
 
-        return pdTRUE;
+/*-----------------------------------------------------------*/
+
+#if( INCLUDE_xTaskCreateReplicated == 1 )
+    static void prvGetCompareValues( const ReplicatedGroup_t * const pxGroup,
+                                     CompareValue_t * xCompareValues,
+                                     UBaseType_t uxCheckpoint )
+    {
+        configASSERT( pxGroup );
+
+        /* WARNING: Shall be called when other replicas are waiting on the
+         * synchronization point */
+
+        for( uint8_t iii = 0; iii < pxGroup->ucNumOfReplicas; iii++ )
+        {
+            xCompareValues[iii] = prvGetCheckpoint( pxGroup->pxReplicas[ iii ], uxCheckpoint );
+        }
     }
 #endif
 
 /*-----------------------------------------------------------*/
 
 #if( INCLUDE_xTaskCreateReplicated == 1 )
-    static uint8_t prvIsLastArrivedRedundantTask( TCB_t * pxTCB )
+    void * pvTaskGetReplicatedState( size_t xStateSize )
     {
-        TCB_t * pxStartTCB = pxTCB;
-        TCB_t * pxWorkTCB = pxTCB;
+        TCB_t * pxTCB = prvGetTCBFromHandle( NULL );
+        ReplicatedGroup_t * pxGroup;
+        void * pvState = NULL;
 
         configASSERT( pxTCB );
-        configASSERT( pxWorkTCB->pxNextTaskHandle );
+        configASSERT( eReplicated == pxTCB->eType );
+        configASSERT( xStateSize > 0 );
 
-        pxWorkTCB = ( TCB_t * ) pxWorkTCB->pxNextTaskHandle;
-        do
-        {
-            /* If task is stuck in this loop pxNextTaskHandle isn't set up
-             * correctly on all replicated tasks */
+        pxGroup = pxTCB->pxReplicatedGroup;
+        configASSERT( pxGroup );
 
-            /* NOTE: First task (calling task) is not checked */
+        /* Blocks of all replicas have the same size */
+        if( ( xStateSize & portBYTE_ALIGNMENT_MASK ) != 0x00 )
+        {
+            xStateSize += ( portBYTE_ALIGNMENT - ( xStateSize & portBYTE_ALIGNMENT_MASK ) );
+        }
 
-            if( pdFALSE == pxWorkTCB->ucIsWaitingOnCompare )
+        /* Allocation is done with the scheduler suspended rather than in a
+         * critical section, other replicas only need to be kept out */
+        vTaskSuspendAll();
+        {
+            if( pxGroup->pvStates == NULL )
             {
-                /* The task is not waiting for comparison, return false */
-                return pdFALSE;
-            }
+                /* First replica to ask allocates the blocks of the whole
+                 * group, so a respawned replica finds its block ready */
+                pxGroup->pvStates = pvPortMalloc( xStateSize * pxGroup->ucNumOfReplicas );
 
-            configASSERT( pxWorkTCB->pxNextTaskHandle );
-            pxWorkTCB = ( TCB_t * ) pxWorkTCB->pxNextTaskHandle;
+                if( pxGroup->pvStates != NULL )
+                {
+                    ( void ) memset( pxGroup->pvStates, 0x00, xStateSize * pxGroup->ucNumOfReplicas );
+                    pxGroup->xStateSize = xStateSize;
+                }
+            }
 
-        } while( pxWorkTCB != pxStartTCB );
+            if( pxGroup->pvStates != NULL )
+            {
+                configASSERT( pxGroup->xStateSize == xStateSize );
 
+                pvState = ( void * ) ( ( uint8_t * ) pxGroup->pvStates +
+                                       ( pxGroup->xStateSize * pxTCB->ucReplicaIndex ) );
+            }
+        }
+        ( void ) xTaskResumeAll();
 
-        return pdTRUE;
+        return pvState;
     }
 #endif
 
 /*-----------------------------------------------------------*/
 
-#if INCLUDE_xTaskCreateTimed == 1
-
-    static BaseType_t prvPauseOverrunTimer( TCB_t * pxTCB, UBaseType_t xIsFromISR )
+#if( INCLUDE_xTaskCreateReplicated == 1 )
+    static BaseType_t prvRespawnDivergedReplicas( ReplicatedGroup_t * const pxGroup,
+                                                  BaseType_t * const pxIsDeletingSelf )
     {
-        BaseType_t xReturn = pdFAIL;
-        if( pxTCB->xOverrunTimer != NULL )
+        const ReplicatedMismatch_t * pxMismatch = &( pxGroup->xMismatch );
+        uint8_t ucSourceIndex = 0;
+
+        /* WARNING: Shall be called when other replicas are waiting on the
+         * synchronization point */
+
+        if( ( ( uint32_t ) pxMismatch->ucVotes * 2UL ) <= ( uint32_t ) pxGroup->ucNumOfReplicas )
+        {
+            return pdFAIL;
+        }
+
+        /* Any replica that agrees with the voted value holds correct state */
+        while( ( pxMismatch->ulDivergedMask & ( ( ( uint32_t ) 1UL ) << ucSourceIndex ) ) != 0 )
+        {
+            ucSourceIndex++;
+        }
+
+        /* New replicas shall not run before they are in the group */
+        vTaskSuspendAll();
+
+        for( uint8_t iii = 0; iii < pxGroup->ucNumOfReplicas; iii++ )
         {
-            if( pdTRUE == xIsFromISR )
+            TCB_t * pxOldTCB = pxGroup->pxReplicas[ iii ];
+
+            if( ( pxMismatch->ulDivergedMask & ( ( ( uint32_t ) 1UL ) << iii ) ) == 0 )
+            {
+                continue;
+            }
+
+            if( pxGroup->pvStates != NULL )
+            {
+                ( void ) memcpy( ( uint8_t * ) pxGroup->pvStates + ( pxGroup->xStateSize * iii ),
+                                 ( uint8_t * ) pxGroup->pvStates + ( pxGroup->xStateSize * ucSourceIndex ),
+                                 pxGroup->xStateSize );
+            }
+
+            if( pxOldTCB == pxCurrentTCB )
             {
-                xReturn = xTimerPauseFromISR( pxTCB->xOverrunTimer, NULL );
+                /* Calling replica still runs on its stack, the caller
+                 * removes it and the idle task respawns it */
+                *pxIsDeletingSelf = pdTRUE;
             }
             else
             {
-                /* Could be potential problem with waiting indefinitely.
-                   If program is stuck here increase the size of timer
-                   input queue or if pausing of overrun timer is not
-                   priority lower the delay. */
-                xReturn = xTimerPause( pxTCB->xOverrunTimer, portMAX_DELAY );
+                /* Replica waits on the synchronization point, so its TCB
+                 * and stack are free once it is removed */
+                taskENTER_CRITICAL();
+                {
+                    ( void ) prvRemoveTask( pxOldTCB );
+                }
+                taskEXIT_CRITICAL();
+
+                prvRespawnReplica( pxGroup, pxOldTCB );
+
+                if( pxOldTCB->ucStaticallyAllocated == tskGROUP_ALLOCATED_STACK_AND_TCB )
+                {
+                    /* Removed task released the block, the new one uses it */
+                    pxGroup->uxBlockTasks++;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
             }
         }
-        return xReturn;
-   }
 
+        ( void ) xTaskResumeAll();
+
+        return pdPASS;
+    }
 #endif
 
 /*-----------------------------------------------------------*/
 
-#if INCLUDE_xTaskCreateTimed == 1
-
-    static BaseType_t prvIsOverrunTimerActive( TCB_t * pxTCB, UBaseType_t xIsFromISR )
+#if( INCLUDE_xTaskCreateReplicated == 1 )
+    static void prvRespawnReplica( ReplicatedGroup_t * const pxGroup,
+                                   TCB_t * const pxTCB )
     {
-        BaseType_t xReturn = pdFAIL;
+        char pcName[ configMAX_TASK_NAME_LEN ];
+        const uint8_t ucIndex = pxTCB->ucReplicaIndex;
+        const uint8_t ucAllocation = pxTCB->ucStaticallyAllocated;
+        const RedundantValueErrorCb_t pxRedundantValueErrorCb = pxTCB->pxRedundantValueErrorCb;
+
+        /* Name is in the TCB that is initialised again */
+        ( void ) memcpy( ( void * ) pcName, ( const void * ) pxTCB->pcTaskName, sizeof( pcName ) );
+
+        /* Memory is already there, so creating the replica can't fail */
+        ( void ) prvTaskCreateStaticGeneric( pxGroup->pxTaskCode,
+                                             pcName,
+                                             pxGroup->usStackDepth,
+                                             pxGroup->pvParameters,
+                                             pxGroup->uxPriority,
+                                             NULL,
+                                             pxTCB->pxStack,
+                                             ( StaticTask_t * ) pxTCB,
+                                             ucAllocation,
+                                             eReplicated,
+                                             0,
+                                             NULL,
+                                             NULL,
+                                             0,
+                                             NULL,
+                                             NULL,
+                                             pxRedundantValueErrorCb );
+
+        pxTCB->pxReplicatedGroup = pxGroup;
+        pxTCB->ucReplicaIndex = ucIndex;
+    }
+#endif
 
-        configASSERT( pxTCB );
+/*-----------------------------------------------------------*/
 
-        if( pxTCB->xOverrunTimer != NULL )
+#if( INCLUDE_xTaskCreateReplicated == 1 )
+    static void prvReleaseGroupBlock( ReplicatedGroup_t * const pxGroup )
+    {
+        configASSERT( pxGroup );
+        configASSERT( pxGroup->uxBlockTasks > ( UBaseType_t ) 0U );
+
+        taskENTER_CRITICAL();
         {
-            if( pdTRUE == xIsFromISR )
+            pxGroup->uxBlockTasks--;
+
+            /* Last replica in the block of a deleted group frees the block */
+            if( ( pxGroup->uxBlockTasks == ( UBaseType_t ) 0U ) && ( pxGroup->xIsDeleted != pdFALSE ) )
             {
-                xReturn = xTimerIsTimerActiveFromISR( pxTCB->xOverrunTimer );
+                vPortFree( pxGroup );
             }
             else
             {
-                /* Could be potential problem with waiting indefinitely.
-                   If program is stuck here increase the size of timer
-                   input queue or if pausing of overrun timer is not
-                   priority lower the delay. */
-                xReturn = xTimerIsTimerActive( pxTCB->xOverrunTimer );
+                mtCOVERAGE_TEST_MARKER();
             }
         }
+        taskEXIT_CRITICAL();
+    }
+#endif
 
-        return xReturn;
-   }
+/*-----------------------------------------------------------*/
+
+#if( INCLUDE_xTaskCreateReplicated == 1 )
+    void vTaskCompareDigestReset( void )
+    {
+        TCB_t * pxTCB = prvGetTCBFromHandle( NULL );
+
+        configASSERT( pxTCB );
+        configASSERT( eReplicated == pxTCB->eType );
 
+        pxTCB->xCompareValue = ( CompareValue_t ) digestINITIAL_VALUE;
+    }
 #endif
 
 /*-----------------------------------------------------------*/
 
-#if INCLUDE_xTaskCreateTimed == 1
+#if( INCLUDE_xTaskCreateReplicated == 1 )
+    void vTaskCompareDigestUpdate( const void * pvData, size_t xLength )
+    {
+        TCB_t * pxTCB = prvGetTCBFromHandle( NULL );
+
+        configASSERT( pxTCB );
+        configASSERT( eReplicated == pxTCB->eType );
+
+        /* Only the calling task writes its compare value, others read it
+         * while this task waits on the synchronization point */
+        pxTCB->xCompareValue = ulCompareDigestUpdate( pxTCB->xCompareValue,
+                                                      pvData,
+                                                      xLength );
+    }
+#endif
+
+/*-----------------------------------------------------------*/
 
-    static BaseType_t prvStartOverflowTimer( TCB_t * pxTCB, UBaseType_t xIsFromISR, BaseType_t * pxHigherPriorityTaskWoken )
+#if( INCLUDE_xTaskCreateReplicated == 1 )
+    void vTaskCompareDigestUpdateScatter( const CompareDigestSegment_t * pxSegments,
+                                          UBaseType_t uxSegments )
     {
-        BaseType_t xReturn = pdFALSE;
+        TCB_t * pxTCB = prvGetTCBFromHandle( NULL );
+        uint32_t ulDigest;
 
         configASSERT( pxTCB );
+        configASSERT( eReplicated == pxTCB->eType );
+        configASSERT( ( pxSegments != NULL ) || ( uxSegments == 0 ) );
 
-        if( pxTCB->xOverflowTimer != NULL )
+        ulDigest = pxTCB->xCompareValue;
+
+        for( UBaseType_t uxSegment = 0; uxSegment < uxSegments; uxSegment++ )
         {
-            if( pdTRUE == xIsFromISR )
-            {
-                if( xTimerIsTimerActiveFromISR( pxTCB->xOverflowTimer ) ==
-                    pdFALSE )
-                {
-                    /* This is the first time starting the timed task, start
-                       the overflow timer. */
-                    xReturn = xTimerStartFromISR( pxTCB->xOverflowTimer,
-                                                  pxHigherPriorityTaskWoken );
-                }
-            }
-            else
-            {
-                if( xTimerIsTimerActive( pxTCB->xOverflowTimer ) ==
-                    pdFALSE )
-                {
-                    /* This is the first time starting the timed task, start
-                       the overflow timer.
-
-                       Could be potential problem with waiting indefinitely.
-                       If program is stuck here increase the size of timer
-                       input queue or if pausing of overrun timer is not
-                       priority lower the delay. */
-                    xReturn = xTimerStart( pxTCB->xOverflowTimer,
-                                           portMAX_DELAY );
-                }
-            }
+            ulDigest = ulCompareDigestUpdate( ulDigest,
+                                              pxSegments[ uxSegment ].pvData,
+                                              pxSegments[ uxSegment ].xLength );
         }
-        return xReturn;
-   }
 
+        pxTCB->xCompareValue = ulDigest;
+    }
 #endif
 
 /*-----------------------------------------------------------*/
 
-#if INCLUDE_xTaskCreateTimed == 1
+#if( INCLUDE_xTaskCreateReplicated == 1 )
+    BaseType_t xTaskGetReplicatedMismatch( TaskHandle_t xTask,
+                                           ReplicatedMismatch_t * pxMismatch )
+    {
+        TCB_t * pxTCB;
+        BaseType_t xReturn;
+
+        configASSERT( pxMismatch );
+
+        taskENTER_CRITICAL();
+        {
+            pxTCB = prvGetTCBFromHandle( xTask );
+            configASSERT( pxTCB->pxReplicatedGroup );
+
+            *pxMismatch = pxTCB->pxReplicatedGroup->xMismatch;
+        }
+        taskEXIT_CRITICAL();
+
+        xReturn = ( pxMismatch->ulDivergedMask != 0 ) ? pdTRUE : pdFALSE;
+
+        return xReturn;
+    }
+#endif
+
+/*-----------------------------------------------------------*/
 
-    static BaseType_t prvResumeOverrunTimer( TCB_t * pxTCB, UBaseType_t xIsFromISR, BaseType_t * pxHigherPriorityTaskWoken )
+#if( INCLUDE_xTaskCreateReplicated == 1 )
+    UBaseType_t uxTaskGetReplicaIndex( TaskHandle_t xTask )
     {
-        BaseType_t xReturn = pdFALSE;
+        TCB_t * pxTCB = prvGetTCBFromHandle( xTask );
+
         configASSERT( pxTCB );
-        if( pxTCB->xOverrunTimer != NULL )
+        configASSERT( eReplicated == pxTCB->eType );
+
+        return ( UBaseType_t ) pxTCB->ucReplicaIndex;
+    }
+#endif
+
+/*-----------------------------------------------------------*/
+
+#if( INCLUDE_xTaskCreateReplicated == 1 )
+    static void prvRecordMismatch( ReplicatedGroup_t * const pxGroup,
+                                   const CompareValue_t * const pxCompareValues,
+                                   uint32_t ulSyncIndex,
+                                   UBaseType_t uxCheckpoint )
+    {
+        ReplicatedMismatch_t * pxMismatch = &( pxGroup->xMismatch );
+
+        pxMismatch->ulSyncIndex = ulSyncIndex;
+        pxMismatch->uxCheckpoint = uxCheckpoint;
+
+        pxMismatch->ucVotes = ucTaskVoteCompareValues( pxCompareValues,
+                                                       pxGroup->ucNumOfReplicas,
+                                                       &( pxMismatch->xVotedValue ) );
+        pxMismatch->ulDivergedMask = 0;
+
+        for( uint8_t iii = 0; iii < pxGroup->ucNumOfReplicas; iii++ )
         {
-            if( pdTRUE == xIsFromISR )
-            {
-                if( xTimerIsTimerActiveFromISR( pxTCB->xOverrunTimer ) ==
-                    pdFALSE )
-                {
-                    xReturn = xTimerResumeFromISR( pxTCB->xOverrunTimer,
-                                                   pxHigherPriorityTaskWoken );
-                }
-            }
-            else
+            if( pxCompareValues[ iii ] != pxMismatch->xVotedValue )
             {
-                if( xTimerIsTimerActive( pxTCB->xOverrunTimer ) ==
-                    pdFALSE )
-                {
-                   /* Could be potential problem with waiting indefinitely.
-                      If program is stuck here increase the size of timer
-                      input queue or if pausing of overrun timer is not
-                      priority lower the delay. */
-                    xReturn = xTimerResume( pxTCB->xOverrunTimer,
-                                            portMAX_DELAY );
-                }
+                pxMismatch->ulDivergedMask |= ( ( uint32_t ) 1UL ) << iii;
             }
         }
-        return xReturn;
     }
+#endif
+
+/*-----------------------------------------------------------*/
+
+#if( INCLUDE_xTaskCreateReplicated == 1 )
+    static BaseType_t prvMarkReplicaArrived( TCB_t * pxTCB )
+    {
+        ReplicatedGroup_t * pxGroup = pxTCB->pxReplicatedGroup;
+        const uint32_t ulReplicaBit = ( ( uint32_t ) 1UL ) << pxTCB->ucReplicaIndex;
+
+        configASSERT( pxGroup );
+
+        /* WARNING: Shall be called from critical section */
+
+        if( ( pxGroup->ulLateMask & ulReplicaBit ) != 0 )
+        {
+            /* Replica is one round behind the released replicas. Replicas
+             * can't get further apart, as no round is released early while
+             * a replica is late. */
+            pxGroup->ulLateMask &= ~ulReplicaBit;
+
+            return replicatedLATE;
+        }
+
+        pxGroup->ulArrivedMask |= ulReplicaBit;
+
+        /* Agreement is tracked against the first arrived replica as
+         * replicas arrive, so neither the last replica nor early release has
+         * to walk the group with interrupts disabled */
+        if( pxGroup->ucArrivedCount == 0 )
+        {
+            pxGroup->pxFirstArrived = pxTCB;
+            pxGroup->xRoundAgrees = pdTRUE;
+        }
+        else if( pxGroup->xRoundAgrees != pdFALSE )
+        {
+            pxGroup->xRoundAgrees = prvReplicasAgree( pxTCB, pxGroup->pxFirstArrived );
+        }
+
+        pxGroup->ucArrivedCount++;
+
+        if( pxGroup->ulArrivedMask == pxGroup->ulMembersMask )
+        {
+            /* Last replica arrived, prepare the mask for the next round.
+             * xRoundAgrees is kept for prvCompareAllReplicas(), other
+             * replicas can't arrive before they are unblocked. */
+            pxGroup->ulArrivedMask = 0;
+            pxGroup->ucArrivedCount = 0;
+            pxGroup->ulSyncCount++;
+
+            return replicatedLAST;
+        }
 
+        if( ( pxGroup->xEarlyRelease == pdFALSE ) ||
+            ( pxGroup->ulLateMask != 0 ) ||
+            ( pxGroup->ulRespawnMask != 0 ) )
+        {
+            return replicatedWAIT;
+        }
+
+        /* Arrived replicas shall all agree and be a majority */
+        if( ( pxGroup->xRoundAgrees == pdFALSE ) ||
+            ( ( ( uint32_t ) pxGroup->ucArrivedCount * 2UL ) <= ( uint32_t ) pxGroup->ucNumOfReplicas ) )
+        {
+            return replicatedWAIT;
+        }
+
+        /* Majority agrees, release it and compare the rest when it arrives */
+        pxGroup->ulLateMask = pxGroup->ulMembersMask & ~pxGroup->ulArrivedMask;
+        pxGroup->xAgreedValue = pxTCB->xCompareValue;
+        pxGroup->ucAgreedVotes = pxGroup->ucArrivedCount;
+        pxGroup->uxAgreedCheckpoints = pxTCB->uxCheckpoints;
+        ( void ) memcpy( ( void * ) pxGroup->xAgreedCheckpoints,
+                         ( const void * ) pxTCB->xCheckpoints,
+                         pxTCB->uxCheckpoints * sizeof( CompareValue_t ) );
+        pxGroup->ulArrivedMask = 0;
+        pxGroup->ucArrivedCount = 0;
+        pxGroup->ulSyncCount++;
+
+        return replicatedEARLY;
+    }
 #endif
 
 /*-----------------------------------------------------------*/
+
 /* Code below here allows additional code to be inserted into this source file,
 especially where access to file scope functions and data is needed (for example
 when performing module tests). */
@@ -64,6 +64,13 @@ defining trmTIMER_SERVICE_TASK_NAME in FreeRTOSConfig.h. */
 	#define configTIMER_SERVICE_TASK_NAME "Tmr Svc"
 #endif
 
+/* The name assigned to the timer service tasks of the lanes after the first.
+This can be overridden by defining configTIMER_LANE_TASK_NAME in
+FreeRTOSConfig.h. */
+#ifndef configTIMER_LANE_TASK_NAME
+	#define configTIMER_LANE_TASK_NAME "Tmr Lane"
+#endif
+
 /* The definition of the timers themselves. */
 typedef struct tmrTimerControl
 {
@@ -72,6 +79,13 @@ typedef struct tmrTimerControl
 	TickType_t				xTimerPeriodInTicks;/*<< How quickly and often the timer expires. */
 	UBaseType_t				uxAutoReload;		/*<< Set to pdTRUE if the timer should be automatically restarted once expired.  Set to pdFALSE if the timer is, in effect, a one-shot timer. */
 	TickType_t              xTimeLeftInTicks;   /*<< Signals number of ticks left until the callback is called. Updated with call to xTimerPause or xTimerPauseFromISR. */
+	#if( configUSE_TIMER_SLACK == 1 )
+		TickType_t			xSlackInTicks;		/*<< The callback may be called up to this many ticks late, so the timer service task can process it with other timers in one wakeup. */
+	#endif
+	#if( configTIMER_SERVICE_LANES > 1 )
+		UBaseType_t			uxLane;				/*<< The lane whose timer service task processes the commands and the callback of the timer. */
+		volatile UBaseType_t	uxCommandsPending;	/*<< Commands sent to the lane of the timer that it hasn't processed yet.  The timer can't change lanes until it is 0. */
+	#endif
 	union
 	{
 	    void 			    *pvTimerID;       	/*<< An ID to identify the timer.  This allows the timer to be identified when the same callback is used for multiple timers. */
@@ -127,23 +141,117 @@ typedef struct tmrTimerQueueMessage
 	} u;
 } DaemonTaskMessage_t;
 
+#if( configUSE_TIMER_COMMAND_RING == 1 )
+
+	/* One slot is always left empty so a full ring can be told apart from an
+	empty one. */
+	#define tmrCOMMAND_RING_SLOTS ( ( UBaseType_t ) configTIMER_QUEUE_LENGTH + ( UBaseType_t ) 1 )
+
+	/* Ring of commands sent to the timer service task.  Any task or interrupt
+	writes at uxHead, only the timer service task reads at uxTail. */
+	typedef struct tmrCommandRing
+	{
+		DaemonTaskMessage_t		xSlots[ tmrCOMMAND_RING_SLOTS ];
+		volatile UBaseType_t	uxHead;		/*<< Next slot to write.  Only changed with interrupts masked. */
+		volatile UBaseType_t	uxTail;		/*<< Next slot to read.  Only changed by the timer service task. */
+	} CommandRing_t;
+
+	/* Returned by prvCommandRingPush() when the command was merged into a
+	pending one, so no new slot was used. */
+	#define tmrCOMMAND_RING_MERGED	( ( BaseType_t ) 2 )
+
+	#define tmrIS_RESET_COMMAND( xCommandID )	( ( ( xCommandID ) == tmrCOMMAND_START ) || ( ( xCommandID ) == tmrCOMMAND_START_FROM_ISR ) || ( ( xCommandID ) == tmrCOMMAND_RESET ) || ( ( xCommandID ) == tmrCOMMAND_RESET_FROM_ISR ) )
+	#define tmrIS_PAUSE_COMMAND( xCommandID )	( ( ( xCommandID ) == tmrCOMMAND_PAUSE ) || ( ( xCommandID ) == tmrCOMMAND_PAUSE_FROM_ISR ) )
+	#define tmrIS_RESUME_COMMAND( xCommandID )	( ( ( xCommandID ) == tmrCOMMAND_RESUME ) || ( ( xCommandID ) == tmrCOMMAND_RESUME_FROM_ISR ) )
+
+#endif /* configUSE_TIMER_COMMAND_RING */
+
+#if( configUSE_TIMER_WHEEL == 1 )
+
+	/* Every level of the wheel has a slot for each value of one digit of the
+	expiry time, enough levels cover all digits of TickType_t. */
+	#define tmrWHEEL_SLOTS		( ( UBaseType_t ) 1 << configTIMER_WHEEL_SLOT_BITS )
+	#define tmrWHEEL_DIGIT_MASK	( ( TickType_t ) tmrWHEEL_SLOTS - ( TickType_t ) 1 )
+	#define tmrWHEEL_LEVELS		( ( ( sizeof( TickType_t ) * 8U ) + configTIMER_WHEEL_SLOT_BITS - 1U ) / configTIMER_WHEEL_SLOT_BITS )
+	#define tmrWHEEL_DIGIT( xTime, uxLevel )	( ( UBaseType_t ) ( ( ( xTime ) >> ( ( uxLevel ) * configTIMER_WHEEL_SLOT_BITS ) ) & tmrWHEEL_DIGIT_MASK ) )
+
+	/* Hierarchical timing wheel of the active timers that expire before the
+	tick count overflows.  A timer is in the level of the highest digit in
+	which its expiry time differs from xTime, in the slot of that digit.  The
+	timers of level 0 in one slot therefore all expire at the same time, the
+	timers of a higher level are moved down when xTime reaches their slot. */
+	typedef struct tmrTimerWheel
+	{
+		List_t		xSlots[ tmrWHEEL_LEVELS ][ tmrWHEEL_SLOTS ];
+		TickType_t	xTime;	/*<< No timer in the wheel expires before this time. */
+	} TimerWheel_t;
+
+#endif /* configUSE_TIMER_WHEEL */
+
+/* A lane is a timer service task with its own priority, command channel and
+active timers.  Every timer belongs to one lane, so the callbacks of a lane are
+only delayed by the callbacks of the same or higher priority lanes. */
+typedef struct tmrTimerLane
+{
+	/* The list in which active timers are stored.  Timers are referenced in
+	expire time order, with the nearest expiry time at the front of the list.
+	Only the timer service task of the lane is allowed to access these lists. */
+	#if( configUSE_TIMER_WHEEL == 1 )
+		/* With the wheel the active timers that expire before the tick count
+		overflows are stored in xTimerWheel.  The overflow list is not sorted,
+		its timers are moved to the wheel when the tick count overflows. */
+		TimerWheel_t		xTimerWheel;
+		List_t				xOverflowTimerList;
+	#else
+		List_t				xActiveTimerList1;
+		List_t				xActiveTimerList2;
+		List_t				*pxCurrentTimerList;
+	#endif
+	List_t					*pxOverflowTimerList;
+
+	#if( configUSE_TIMER_COMMAND_RING == 1 )
+		/* A ring that is used to send commands to the timer service task, the
+		end of the batch of commands the timer service task is reading, and if
+		the slot at the tail holds the command being processed. */
+		CommandRing_t		xTimerCommandRing;
+		UBaseType_t			uxCommandBatchEnd;
+		volatile BaseType_t	xCommandRingTailHeld;
+	#else
+		/* A queue that is used to send commands to the timer service task. */
+		QueueHandle_t		xTimerQueue;
+	#endif
+	TaskHandle_t			xTimerTaskHandle;
+	TickType_t				xLastTime;	/*<< The tick count the timer service task last sampled, to detect its overflow. */
+} TimerLane_t;
+
 /*lint -save -e956 A manual analysis and inspection has been used to determine
 which static variables must be declared volatile. */
 
-/* The list in which active timers are stored.  Timers are referenced in expire
-time order, with the nearest expiry time at the front of the list.  Only the
-timer service task is allowed to access these lists. */
-PRIVILEGED_DATA static List_t xActiveTimerList1 = {0};
-PRIVILEGED_DATA static List_t xActiveTimerList2 = {0};
-PRIVILEGED_DATA static List_t *pxCurrentTimerList = NULL;
-PRIVILEGED_DATA static List_t *pxOverflowTimerList = NULL;
-
-/* A queue that is used to send commands to the timer service task. */
-PRIVILEGED_DATA static QueueHandle_t xTimerQueue = NULL;
-PRIVILEGED_DATA static TaskHandle_t xTimerTaskHandle = NULL;
+/* Lane 0 runs at configTIMER_TASK_PRIORITY and gets the timers of the
+application unless they are moved with vTimerSetLane(). */
+PRIVILEGED_DATA static TimerLane_t xTimerLanes[ configTIMER_SERVICE_LANES ];
 
 /*lint -restore */
 
+#if( configTIMER_SERVICE_LANES > 1 )
+	#define tmrGET_LANE( pxTimer )	( &( xTimerLanes[ ( pxTimer )->uxLane ] ) )
+#else
+	#define tmrGET_LANE( pxTimer )	( &( xTimerLanes[ 0 ] ) )
+#endif
+
+#if( configUSE_TIMER_COMMAND_RING == 1 )
+	/* The ring needs no creation, it can be used once the lists are ready. */
+	#define tmrCOMMAND_CHANNEL_IS_VALID( pxLane )	( ( pxLane )->pxOverflowTimerList != NULL )
+	#define tmrSEND_COMMAND( pxLane, pxMessage, xTicksToWait )	prvCommandRingSend( ( pxLane ), ( pxMessage ), ( xTicksToWait ) )
+	#define tmrSEND_COMMAND_FROM_ISR( pxLane, pxMessage, pxHigherPriorityTaskWoken )	prvCommandRingSendFromISR( ( pxLane ), ( pxMessage ), ( pxHigherPriorityTaskWoken ) )
+	#define tmrRECEIVE_COMMAND( pxLane, pxMessage )	prvCommandRingReceive( ( pxLane ), ( pxMessage ) )
+#else
+	#define tmrCOMMAND_CHANNEL_IS_VALID( pxLane )	( ( pxLane )->xTimerQueue != NULL )
+	#define tmrSEND_COMMAND( pxLane, pxMessage, xTicksToWait )	xQueueSendToBack( ( pxLane )->xTimerQueue, ( pxMessage ), ( xTicksToWait ) )
+	#define tmrSEND_COMMAND_FROM_ISR( pxLane, pxMessage, pxHigherPriorityTaskWoken )	xQueueSendToBackFromISR( ( pxLane )->xTimerQueue, ( pxMessage ), ( pxHigherPriorityTaskWoken ) )
+	#define tmrRECEIVE_COMMAND( pxLane, pxMessage )	xQueueReceive( ( pxLane )->xTimerQueue, ( pxMessage ), tmrNO_DELAY )
+#endif
+
 /*-----------------------------------------------------------*/
 
 #if( configSUPPORT_STATIC_ALLOCATION == 1 )
@@ -163,41 +271,127 @@ PRIVILEGED_DATA static TaskHandle_t xTimerTaskHandle = NULL;
 static void prvCheckForValidListAndQueue( void ) PRIVILEGED_FUNCTION;
 
 /*
- * The timer service task (daemon).  Timer functionality is controlled by this
- * task.  Other tasks communicate with the timer service task using the
- * xTimerQueue queue.
+ * Create the timer service task of the lane.
+ */
+static BaseType_t prvCreateLaneTask( TimerLane_t * const pxLane, const UBaseType_t uxLane ) PRIVILEGED_FUNCTION;
+
+/*
+ * Adds xCommands, which is negative for processed commands, to the number of
+ * pending commands of the timer, see vTimerSetLane().
+ */
+#if( configTIMER_SERVICE_LANES > 1 )
+	static void prvCountPendingCommands( Timer_t * const pxTimer, const BaseType_t xCommands ) PRIVILEGED_FUNCTION;
+#endif
+
+/*
+ * The timer service task (daemon) of the lane passed in pvParameters.  Timer
+ * functionality is controlled by this task.  Other tasks communicate with the
+ * timer service task using the xTimerQueue queue of the lane, or the
+ * xTimerCommandRing ring if configUSE_TIMER_COMMAND_RING is set to 1.
  */
 static void prvTimerTask( void *pvParameters ) PRIVILEGED_FUNCTION;
 
+#if( configUSE_TIMER_COMMAND_RING == 1 )
+
+	/*
+	 * Copy a command into a free slot of the ring and publish it.  Can be
+	 * called from tasks and interrupts, never blocks.
+	 */
+	static BaseType_t prvCommandRingPush( TimerLane_t * const pxLane, const DaemonTaskMessage_t * const pxMessage ) PRIVILEGED_FUNCTION;
+
+	#if( configUSE_TIMER_COMMAND_COALESCING == 1 )
+
+		/*
+		 * Merge a command into the last pending command for the same timer if
+		 * the result is the same as processing both.  Called with interrupts
+		 * masked, returns pdTRUE if the command was merged.
+		 */
+		static BaseType_t prvCommandRingCoalesce( TimerLane_t * const pxLane, const DaemonTaskMessage_t * const pxMessage ) PRIVILEGED_FUNCTION;
+
+	#endif
+
+	/*
+	 * Send a command from a task and notify the timer service task.  If the ring
+	 * is full the sender retries once a tick for up to xTicksToWait ticks.
+	 */
+	static BaseType_t prvCommandRingSend( TimerLane_t * const pxLane, const DaemonTaskMessage_t * const pxMessage, TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Send a command from an interrupt and notify the timer service task.
+	 */
+	static BaseType_t prvCommandRingSendFromISR( TimerLane_t * const pxLane, const DaemonTaskMessage_t * const pxMessage, BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Called by the timer service task to take the oldest command from the ring.
+	 */
+	static BaseType_t prvCommandRingReceive( TimerLane_t * const pxLane, DaemonTaskMessage_t * const pxMessage ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Block the timer service task on its notification until a command is sent
+	 * or xTicksToExpire ticks after xTimeBefore have passed.
+	 */
+	static void prvCommandRingWait( TimerLane_t * const pxLane, const TickType_t xTicksToExpire, const TickType_t xTimeBefore, const BaseType_t xWaitIndefinitely ) PRIVILEGED_FUNCTION;
+
+#endif /* configUSE_TIMER_COMMAND_RING */
+
 /*
  * Called by the timer service task to interpret and process a command it
  * received on the timer queue.
  */
-static void prvProcessReceivedCommands( void ) PRIVILEGED_FUNCTION;
+static void prvProcessReceivedCommands( TimerLane_t * const pxLane ) PRIVILEGED_FUNCTION;
 
 /*
  * Insert the timer into either xActiveTimerList1, or xActiveTimerList2,
  * depending on if the expire time causes a timer counter overflow.
  */
-static BaseType_t prvInsertTimerInActiveList( Timer_t * const pxTimer, const TickType_t xNextExpiryTime, const TickType_t xTimeNow, const TickType_t xCommandTime ) PRIVILEGED_FUNCTION;
+static BaseType_t prvInsertTimerInActiveList( TimerLane_t * const pxLane, Timer_t * const pxTimer, const TickType_t xNextExpiryTime, const TickType_t xTimeNow, const TickType_t xCommandTime ) PRIVILEGED_FUNCTION;
 
 /*
  * An active timer has reached its expire time.  Reload the timer if it is an
  * auto reload timer, then call its callback.
  */
-static void prvProcessExpiredTimer( const TickType_t xNextExpireTime, const TickType_t xTimeNow ) PRIVILEGED_FUNCTION;
+static void prvProcessExpiredTimer( TimerLane_t * const pxLane, const TickType_t xNextExpireTime, const TickType_t xTimeNow ) PRIVILEGED_FUNCTION;
 
 /*
  * The tick count has overflowed.  Switch the timer lists after ensuring the
  * current timer list does not still reference some timers.
  */
-static void prvSwitchTimerLists( void ) PRIVILEGED_FUNCTION;
+static void prvSwitchTimerLists( TimerLane_t * const pxLane ) PRIVILEGED_FUNCTION;
+
+/*
+ * Return the timer that expires at xNextExpireTime, a time returned by
+ * prvGetNextExpireTime().
+ */
+static Timer_t * prvGetExpiredTimer( TimerLane_t * const pxLane, const TickType_t xNextExpireTime ) PRIVILEGED_FUNCTION;
+
+#if( configUSE_TIMER_WHEEL == 1 )
+
+	/*
+	 * Insert the list item of a timer into the slot of the wheel given by its
+	 * value, the expiry time.  Takes at most one step per level of the wheel.
+	 */
+	static void prvTimerWheelInsert( TimerWheel_t * const pxWheel, ListItem_t * const pxItem ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Get the expiry time of the first timer in the wheel.  Only the first
+	 * occupied slot is searched.  Returns pdFALSE if the wheel is empty.
+	 */
+	static BaseType_t prvTimerWheelGetNextTime( const TimerWheel_t * const pxWheel, TickType_t * const pxNextTime ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Move the time of the wheel to xTime, the time returned by
+	 * prvTimerWheelGetNextTime(), and move down the timers of the slot xTime
+	 * enters.  Returns the first timer expiring at xTime.
+	 */
+	static Timer_t * prvTimerWheelAdvance( TimerWheel_t * const pxWheel, const TickType_t xTime ) PRIVILEGED_FUNCTION;
+
+#endif /* configUSE_TIMER_WHEEL */
 
 /*
  * Obtain the current tick count, setting *pxTimerListsWereSwitched to pdTRUE
  * if a tick count overflow occurred since prvSampleTimeNow() was last called.
  */
-static TickType_t prvSampleTimeNow( BaseType_t * const pxTimerListsWereSwitched ) PRIVILEGED_FUNCTION;
+static TickType_t prvSampleTimeNow( TimerLane_t * const pxLane, BaseType_t * const pxTimerListsWereSwitched ) PRIVILEGED_FUNCTION;
 
 /*
  * If the timer list contains any active timers then return the expire time of
@@ -205,13 +399,29 @@ static TickType_t prvSampleTimeNow( BaseType_t * const pxTimerListsWereSwitched
  * timer list does not contain any timers then return 0 and set *pxListWasEmpty
  * to pdTRUE.
  */
-static TickType_t prvGetNextExpireTime( BaseType_t * const pxListWasEmpty ) PRIVILEGED_FUNCTION;
+static TickType_t prvGetNextExpireTime( TimerLane_t * const pxLane, BaseType_t * const pxListWasEmpty ) PRIVILEGED_FUNCTION;
 
 /*
  * If a timer has expired, process it.  Otherwise, block the timer service task
  * until either a timer does expire or a command is received.
  */
-static void prvProcessTimerOrBlockTask( const TickType_t xNextExpireTime, BaseType_t xListWasEmpty ) PRIVILEGED_FUNCTION;
+static void prvProcessTimerOrBlockTask( TimerLane_t * const pxLane, const TickType_t xNextExpireTime, BaseType_t xListWasEmpty ) PRIVILEGED_FUNCTION;
+
+#if( configUSE_TIMER_SLACK == 1 )
+
+	/*
+	 * Get the latest time the timer service task can wake without any timer
+	 * expiring later than its slack allows.  Only the timers expiring before
+	 * that time are looked at.  The current timer list must not be empty.
+	 */
+	static TickType_t prvGetWakeTime( TimerLane_t * const pxLane ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Lower *pxWakeTime to the expiry time plus slack of the timer of pxItem.
+	 */
+	static void prvLimitWakeTime( TickType_t * const pxWakeTime, const ListItem_t * const pxItem ) PRIVILEGED_FUNCTION;
+
+#endif /* configUSE_TIMER_SLACK */
 
 /*
  * Called after a Timer_t structure has been allocated either statically or
@@ -227,53 +437,88 @@ static void prvInitialiseNewTimer(	const char * const pcTimerName,			/*lint !e97
 
 BaseType_t xTimerCreateTimerTask( void )
 {
-BaseType_t xReturn = pdFAIL;
+BaseType_t xReturn = pdPASS;
+UBaseType_t uxLane;
 
 	/* This function is called when the scheduler is started if
 	configUSE_TIMERS is set to 1.  Check that the infrastructure used by the
-	timer service task has been created/initialised.  If timers have already
+	timer service tasks has been created/initialised.  If timers have already
 	been created then the initialisation will already have been performed. */
 	prvCheckForValidListAndQueue();
 
-	if( xTimerQueue != NULL )
+	for( uxLane = 0; ( uxLane < ( UBaseType_t ) configTIMER_SERVICE_LANES ) && ( xReturn == pdPASS ); uxLane++ )
 	{
-		#if( configSUPPORT_STATIC_ALLOCATION == 1 )
+		if( tmrCOMMAND_CHANNEL_IS_VALID( &( xTimerLanes[ uxLane ] ) ) )
 		{
-			StaticTask_t *pxTimerTaskTCBBuffer = NULL;
-			StackType_t *pxTimerTaskStackBuffer = NULL;
-			uint32_t ulTimerTaskStackSize;
+			xReturn = prvCreateLaneTask( &( xTimerLanes[ uxLane ] ), uxLane );
+		}
+		else
+		{
+			xReturn = pdFAIL;
+		}
+	}
 
-			vApplicationGetTimerTaskMemory( &pxTimerTaskTCBBuffer, &pxTimerTaskStackBuffer, &ulTimerTaskStackSize );
-			xTimerTaskHandle = xTaskCreateStatic(	prvTimerTask,
-													configTIMER_SERVICE_TASK_NAME,
-													ulTimerTaskStackSize,
-													NULL,
-													( ( UBaseType_t ) configTIMER_TASK_PRIORITY ) | portPRIVILEGE_BIT,
-													pxTimerTaskStackBuffer,
-													pxTimerTaskTCBBuffer );
-
-			if( xTimerTaskHandle != NULL )
+	configASSERT( xReturn );
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvCreateLaneTask( TimerLane_t * const pxLane, const UBaseType_t uxLane )
+{
+BaseType_t xReturn = pdFAIL;
+static const UBaseType_t uxLanePriorities[ configTIMER_SERVICE_LANES ] = configTIMER_LANE_PRIORITIES;
+const char * const pcName = ( uxLane == ( UBaseType_t ) 0 ) ? configTIMER_SERVICE_TASK_NAME : configTIMER_LANE_TASK_NAME; /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+
+	#if( configSUPPORT_STATIC_ALLOCATION == 1 )
+	{
+		StaticTask_t *pxTimerTaskTCBBuffer = NULL;
+		StackType_t *pxTimerTaskStackBuffer = NULL;
+		uint32_t ulTimerTaskStackSize;
+
+		#if( configTIMER_SERVICE_LANES > 1 )
+			/* The application provides the memory of the first lane, as it
+			does for a single timer service task.  The other lanes are
+			allocated statically in case configSUPPORT_DYNAMIC_ALLOCATION is
+			0. */
+			static StaticTask_t xLaneTaskTCBs[ configTIMER_SERVICE_LANES - 1 ]; /*lint !e956 Ok to declare in this manner to prevent additional conditional compilation guards in other locations. */
+			static StackType_t xLaneTaskStacks[ configTIMER_SERVICE_LANES - 1 ][ configTIMER_TASK_STACK_DEPTH ]; /*lint !e956 Ok to declare in this manner to prevent additional conditional compilation guards in other locations. */
+
+			if( uxLane > ( UBaseType_t ) 0 )
 			{
-				xReturn = pdPASS;
+				pxTimerTaskTCBBuffer = &( xLaneTaskTCBs[ uxLane - 1U ] );
+				pxTimerTaskStackBuffer = &( xLaneTaskStacks[ uxLane - 1U ][ 0 ] );
+				ulTimerTaskStackSize = ( uint32_t ) configTIMER_TASK_STACK_DEPTH;
 			}
+			else
+		#endif /* configTIMER_SERVICE_LANES */
+		{
+			vApplicationGetTimerTaskMemory( &pxTimerTaskTCBBuffer, &pxTimerTaskStackBuffer, &ulTimerTaskStackSize );
 		}
-		#else
+
+		pxLane->xTimerTaskHandle = xTaskCreateStatic(	prvTimerTask,
+														pcName,
+														ulTimerTaskStackSize,
+														( void * ) pxLane,
+														uxLanePriorities[ uxLane ] | portPRIVILEGE_BIT,
+														pxTimerTaskStackBuffer,
+														pxTimerTaskTCBBuffer );
+
+		if( pxLane->xTimerTaskHandle != NULL )
 		{
-			xReturn = xTaskCreate(	prvTimerTask,
-									configTIMER_SERVICE_TASK_NAME,
-									configTIMER_TASK_STACK_DEPTH,
-									NULL,
-									( ( UBaseType_t ) configTIMER_TASK_PRIORITY ) | portPRIVILEGE_BIT,
-									&xTimerTaskHandle );
+			xReturn = pdPASS;
 		}
-		#endif /* configSUPPORT_STATIC_ALLOCATION */
 	}
-	else
+	#else
 	{
-		mtCOVERAGE_TEST_MARKER();
+		xReturn = xTaskCreate(	prvTimerTask,
+								pcName,
+								configTIMER_TASK_STACK_DEPTH,
+								( void * ) pxLane,
+								uxLanePriorities[ uxLane ] | portPRIVILEGE_BIT,
+								&( pxLane->xTimerTaskHandle ) );
 	}
+	#endif /* configSUPPORT_STATIC_ALLOCATION */
 
-	configASSERT( xReturn );
 	return xReturn;
 }
 /*-----------------------------------------------------------*/
@@ -378,6 +623,17 @@ static void prvInitialiseNewTimer(	const char * const pcTimerName,			/*lint !e97
 		pxNewTimer->pvTimerID = pvTimerID;
 		pxNewTimer->pxCallbackFunction = pxCallbackFunction;
 		pxNewTimer->xTimeLeftInTicks = xTimerPeriodInTicks;
+		#if( configUSE_TIMER_SLACK == 1 )
+		{
+			pxNewTimer->xSlackInTicks = ( TickType_t ) 0U;
+		}
+		#endif
+		#if( configTIMER_SERVICE_LANES > 1 )
+		{
+			pxNewTimer->uxLane = ( UBaseType_t ) 0U;
+			pxNewTimer->uxCommandsPending = ( UBaseType_t ) 0U;
+		}
+		#endif
 		vListInitialiseItem( &( pxNewTimer->xTimerListItem ) );
 		traceTIMER_CREATE( pxNewTimer );
 	}
@@ -388,33 +644,57 @@ BaseType_t xTimerGenericCommand( TimerHandle_t xTimer, const BaseType_t xCommand
 {
 BaseType_t xReturn = pdFAIL;
 DaemonTaskMessage_t xMessage;
+TimerLane_t *pxLane;
 
 	configASSERT( xTimer );
+	pxLane = tmrGET_LANE( ( Timer_t * ) xTimer );
 
-	/* Send a message to the timer service task to perform a particular action
-	on a particular timer definition. */
-	if( xTimerQueue != NULL )
+	/* Send a message to the timer service task of the lane of the timer to
+	perform a particular action on a particular timer definition. */
+	if( tmrCOMMAND_CHANNEL_IS_VALID( pxLane ) )
 	{
 		/* Send a command to the timer service task to start the xTimer timer. */
 		xMessage.xMessageID = xCommandID;
 		xMessage.u.xTimerParameters.xMessageValue = xOptionalValue;
 		xMessage.u.xTimerParameters.pxTimer = ( Timer_t * ) xTimer;
 
+		#if( ( configTIMER_SERVICE_LANES > 1 ) && ( configUSE_TIMER_COMMAND_RING == 0 ) )
+		{
+			/* Counted before the command is sent, the timer service task can
+			process it before the send returns.  The ring counts its commands
+			itself, as it can merge them. */
+			prvCountPendingCommands( ( Timer_t * ) xTimer, ( BaseType_t ) 1 );
+		}
+		#endif
+
 		if( xCommandID < tmrFIRST_FROM_ISR_COMMAND )
 		{
 			if( xTaskGetSchedulerState() == taskSCHEDULER_RUNNING )
 			{
-				xReturn = xQueueSendToBack( xTimerQueue, &xMessage, xTicksToWait );
+				xReturn = tmrSEND_COMMAND( pxLane, &xMessage, xTicksToWait );
 			}
 			else
 			{
-				xReturn = xQueueSendToBack( xTimerQueue, &xMessage, tmrNO_DELAY );
+				xReturn = tmrSEND_COMMAND( pxLane, &xMessage, tmrNO_DELAY );
 			}
 		}
 		else
 		{
-			xReturn = xQueueSendToBackFromISR( xTimerQueue, &xMessage, pxHigherPriorityTaskWoken );
+			xReturn = tmrSEND_COMMAND_FROM_ISR( pxLane, &xMessage, pxHigherPriorityTaskWoken );
+		}
+
+		#if( ( configTIMER_SERVICE_LANES > 1 ) && ( configUSE_TIMER_COMMAND_RING == 0 ) )
+		{
+			if( xReturn != pdPASS )
+			{
+				prvCountPendingCommands( ( Timer_t * ) xTimer, ( BaseType_t ) -1 );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
 		}
+		#endif
 
 		traceTIMER_COMMAND_SEND( xTimer, xCommandID, xOptionalValue, xReturn );
 	}
@@ -430,12 +710,25 @@ DaemonTaskMessage_t xMessage;
 TaskHandle_t xTimerGetTimerDaemonTaskHandle( void )
 {
 	/* If xTimerGetTimerDaemonTaskHandle() is called before the scheduler has been
-	started, then xTimerTaskHandle will be NULL. */
-	configASSERT( ( xTimerTaskHandle != NULL ) );
-	return xTimerTaskHandle;
+	started, then xTimerTaskHandle will be NULL.  The daemon task is the task of
+	lane 0. */
+	configASSERT( ( xTimerLanes[ 0 ].xTimerTaskHandle != NULL ) );
+	return xTimerLanes[ 0 ].xTimerTaskHandle;
 }
 /*-----------------------------------------------------------*/
 
+#if( configTIMER_SERVICE_LANES > 1 )
+
+	TaskHandle_t xTimerGetLaneTaskHandle( const UBaseType_t uxLane )
+	{
+		configASSERT( uxLane < ( UBaseType_t ) configTIMER_SERVICE_LANES );
+		configASSERT( ( xTimerLanes[ uxLane ].xTimerTaskHandle != NULL ) );
+		return xTimerLanes[ uxLane ].xTimerTaskHandle;
+	}
+
+#endif /* configTIMER_SERVICE_LANES */
+/*-----------------------------------------------------------*/
+
 TickType_t xTimerGetPeriod( TimerHandle_t xTimer )
 {
 Timer_t *pxTimer = ( Timer_t * ) xTimer;
@@ -465,10 +758,10 @@ Timer_t *pxTimer = ( Timer_t * ) xTimer;
 }
 /*-----------------------------------------------------------*/
 
-static void prvProcessExpiredTimer( const TickType_t xNextExpireTime, const TickType_t xTimeNow )
+static void prvProcessExpiredTimer( TimerLane_t * const pxLane, const TickType_t xNextExpireTime, const TickType_t xTimeNow )
 {
 BaseType_t xResult;
-Timer_t * const pxTimer = ( Timer_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxCurrentTimerList );
+Timer_t * const pxTimer = prvGetExpiredTimer( pxLane, xNextExpireTime );
 
 	/* Remove the timer from the list of active timers.  A check has already
 	been performed to ensure the list is not empty. */
@@ -484,7 +777,7 @@ Timer_t * const pxTimer = ( Timer_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxCurrentTi
 		/* The timer is inserted into a list using a time relative to anything
 		other than the current time.  It will therefore be inserted into the
 		correct list relative to the time this task thinks it is now. */
-		if( prvInsertTimerInActiveList( pxTimer, ( xNextExpireTime + pxTimer->xTimerPeriodInTicks ), xTimeNow, xNextExpireTime ) != pdFALSE )
+		if( prvInsertTimerInActiveList( pxLane, pxTimer, ( xNextExpireTime + pxTimer->xTimerPeriodInTicks ), xTimeNow, xNextExpireTime ) != pdFALSE )
 		{
 			/* The timer expired before it was added to the active timer
 			list.  Reload it now.  */
@@ -507,15 +800,31 @@ Timer_t * const pxTimer = ( Timer_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxCurrentTi
 }
 /*-----------------------------------------------------------*/
 
-static void	prvProcessReceivedCommands( void )
+static void	prvProcessReceivedCommands( TimerLane_t * const pxLane )
 {
 DaemonTaskMessage_t xMessage;
 Timer_t *pxTimer;
 BaseType_t xTimerListsWereSwitched, xResult;
 TickType_t xTimeNow;
 
-	while( xQueueReceive( xTimerQueue, &xMessage, tmrNO_DELAY ) != pdFAIL ) /*lint !e603 xMessage does not have to be initialised as it is passed out, not in, and it is not used unless xQueueReceive() returns pdTRUE. */
+	while( tmrRECEIVE_COMMAND( pxLane, &xMessage ) != pdFAIL ) /*lint !e603 xMessage does not have to be initialised as it is passed out, not in, and it is not used unless xQueueReceive() returns pdTRUE. */
 	{
+		#if( configUSE_TIMER_COMMAND_COALESCING == 1 )
+		{
+			if( xMessage.xMessageID == tmrCOMMAND_NONE )
+			{
+				/* The command was cancelled by a later one while it was in
+				the ring. */
+				#if( configTIMER_SERVICE_LANES > 1 )
+				{
+					prvCountPendingCommands( xMessage.u.xTimerParameters.pxTimer, ( BaseType_t ) -1 );
+				}
+				#endif
+				continue;
+			}
+		}
+		#endif /* configUSE_TIMER_COMMAND_COALESCING */
+
 		#if ( INCLUDE_xTimerPendFunctionCall == 1 )
 		{
 			/* Negative commands are pended function calls rather than timer
@@ -546,6 +855,9 @@ TickType_t xTimeNow;
 			software timer. */
 			pxTimer = xMessage.u.xTimerParameters.pxTimer;
 
+			/* Commands are sent to the lane of the timer. */
+			configASSERT( tmrGET_LANE( pxTimer ) == pxLane );
+
             TickType_t xExpiryTime = xTimerGetExpiryTime( ( TimerHandle_t ) pxTimer );
 
             BaseType_t xWasTimerActive;
@@ -571,7 +883,7 @@ TickType_t xTimeNow;
 			possibility of a higher priority task adding a message to the message
 			queue with a time that is ahead of the timer daemon task (because it
 			pre-empted the timer daemon task after the xTimeNow value was set). */
-			xTimeNow = prvSampleTimeNow( &xTimerListsWereSwitched );
+			xTimeNow = prvSampleTimeNow( pxLane, &xTimerListsWereSwitched );
 
 			switch( xMessage.xMessageID )
 			{
@@ -581,7 +893,7 @@ TickType_t xTimeNow;
 			    case tmrCOMMAND_RESET_FROM_ISR :
 				case tmrCOMMAND_START_DONT_TRACE :
 					/* Start or restart a timer. */
-					if( prvInsertTimerInActiveList( pxTimer,  xMessage.u.xTimerParameters.xMessageValue + pxTimer->xTimerPeriodInTicks, xTimeNow, xMessage.u.xTimerParameters.xMessageValue ) != pdFALSE )
+					if( prvInsertTimerInActiveList( pxLane, pxTimer,  xMessage.u.xTimerParameters.xMessageValue + pxTimer->xTimerPeriodInTicks, xTimeNow, xMessage.u.xTimerParameters.xMessageValue ) != pdFALSE )
 					{
 						/* The timer expired before it was added to the active
 						timer list.  Process it now. */
@@ -617,7 +929,7 @@ TickType_t xTimeNow;
 
                 case tmrCOMMAND_RESUME:
                 case tmrCOMMAND_RESUME_FROM_ISR:
-                    if( prvInsertTimerInActiveList( pxTimer,  xMessage.u.xTimerParameters.xMessageValue + pxTimer->xTimeLeftInTicks, xTimeNow, xMessage.u.xTimerParameters.xMessageValue ) != pdFALSE )
+                    if( prvInsertTimerInActiveList( pxLane, pxTimer,  xMessage.u.xTimerParameters.xMessageValue + pxTimer->xTimeLeftInTicks, xTimeNow, xMessage.u.xTimerParameters.xMessageValue ) != pdFALSE )
                     {
                         /* The timer expired before it was added to the active
                         timer list.  Process it now. */
@@ -682,7 +994,7 @@ TickType_t xTimeNow;
 					be zero the next expiry time can only be in the future,
 					meaning (unlike for the xTimerStart() case above) there is
 					no fail case that needs to be handled here. */
-					( void ) prvInsertTimerInActiveList( pxTimer, ( xTimeNow + pxTimer->xTimerPeriodInTicks ), xTimeNow, xTimeNow );
+					( void ) prvInsertTimerInActiveList( pxLane, pxTimer, ( xTimeNow + pxTimer->xTimerPeriodInTicks ), xTimeNow, xTimeNow );
 					break;
 
 				case tmrCOMMAND_DELETE :
@@ -716,6 +1028,21 @@ TickType_t xTimeNow;
 					/* Don't expect to get here. */
 					break;
 			}
+
+			#if( configTIMER_SERVICE_LANES > 1 )
+			{
+				/* Only counted once the command is done, so the timer can't
+				be moved while it is processed.  A deleted timer is gone. */
+				if( xMessage.xMessageID != tmrCOMMAND_DELETE )
+				{
+					prvCountPendingCommands( pxTimer, ( BaseType_t ) -1 );
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			#endif
 		}
 	}
 }
@@ -723,9 +1050,7 @@ static void prvTimerTask( void *pvParameters )
 {
 TickType_t xNextExpireTime;
 BaseType_t xListWasEmpty;
-
-	/* Just to avoid compiler warnings. */
-	( void ) pvParameters;
+TimerLane_t * const pxLane = ( TimerLane_t * ) pvParameters;
 
 	#if( configUSE_DAEMON_TASK_STARTUP_HOOK == 1 )
 	{
@@ -734,8 +1059,16 @@ BaseType_t xListWasEmpty;
 		/* Allow the application writer to execute some code in the context of
 		this task at the point the task starts executing.  This is useful if the
 		application includes initialisation code that would benefit from
-		executing after the scheduler has been started. */
-		vApplicationDaemonTaskStartupHook();
+		executing after the scheduler has been started.  Only the daemon task,
+		the task of lane 0, calls the hook. */
+		if( pxLane == &( xTimerLanes[ 0 ] ) )
+		{
+			vApplicationDaemonTaskStartupHook();
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
 	}
 	#endif /* configUSE_DAEMON_TASK_STARTUP_HOOK */
 
@@ -743,21 +1076,21 @@ BaseType_t xListWasEmpty;
 	{
 		/* Query the timers list to see if it contains any timers, and if so,
 		obtain the time at which the next timer will expire. */
-		xNextExpireTime = prvGetNextExpireTime( &xListWasEmpty );
+		xNextExpireTime = prvGetNextExpireTime( pxLane, &xListWasEmpty );
 
 		/* If a timer has expired, process it.  Otherwise, block this task
 		until either a timer does expire, or a command is received. */
-		prvProcessTimerOrBlockTask( xNextExpireTime, xListWasEmpty );
+		prvProcessTimerOrBlockTask( pxLane, xNextExpireTime, xListWasEmpty );
 
 		/* Empty the command queue. */
-		prvProcessReceivedCommands();
+		prvProcessReceivedCommands( pxLane );
 	}
 }
 /*-----------------------------------------------------------*/
 
-static void prvProcessTimerOrBlockTask( const TickType_t xNextExpireTime, BaseType_t xListWasEmpty )
+static void prvProcessTimerOrBlockTask( TimerLane_t * const pxLane, const TickType_t xNextExpireTime, BaseType_t xListWasEmpty )
 {
-TickType_t xTimeNow;
+TickType_t xTimeNow, xWakeTime = xNextExpireTime;
 BaseType_t xTimerListsWereSwitched;
 
 	vTaskSuspendAll();
@@ -767,14 +1100,14 @@ BaseType_t xTimerListsWereSwitched;
 		then don't process this timer as any timers that remained in the list
 		when the lists were switched will have been processed within the
 		prvSampleTimeNow() function. */
-		xTimeNow = prvSampleTimeNow( &xTimerListsWereSwitched );
+		xTimeNow = prvSampleTimeNow( pxLane, &xTimerListsWereSwitched );
 		if( xTimerListsWereSwitched == pdFALSE )
 		{
 			/* The tick count has not overflowed, has the timer expired? */
 			if( ( xListWasEmpty == pdFALSE ) && ( xNextExpireTime <= xTimeNow ) )
 			{
 				( void ) xTaskResumeAll();
-				prvProcessExpiredTimer( xNextExpireTime, xTimeNow );
+				prvProcessExpiredTimer( pxLane, xNextExpireTime, xTimeNow );
 			}
 			else
 			{
@@ -784,27 +1117,49 @@ BaseType_t xTimerListsWereSwitched;
 				received - whichever comes first.  The following line cannot
 				be reached unless xNextExpireTime > xTimeNow, except in the
 				case when the current timer list is empty. */
+				#if( configUSE_TIMER_SLACK == 1 )
+				{
+					/* Timers that expire before the slack of the first ones
+					runs out are processed in the same wakeup. */
+					if( xListWasEmpty == pdFALSE )
+					{
+						xWakeTime = prvGetWakeTime( pxLane );
+					}
+				}
+				#endif /* configUSE_TIMER_SLACK */
+
 				if( xListWasEmpty != pdFALSE )
 				{
 					/* The current timer list is empty - is the overflow list
 					also empty? */
-					xListWasEmpty = listLIST_IS_EMPTY( pxOverflowTimerList );
+					xListWasEmpty = listLIST_IS_EMPTY( pxLane->pxOverflowTimerList );
 				}
 
-				vQueueWaitForMessageRestricted( xTimerQueue, ( xNextExpireTime - xTimeNow ), xListWasEmpty );
-
-				if( xTaskResumeAll() == pdFALSE )
+				#if( configUSE_TIMER_COMMAND_RING == 1 )
 				{
-					/* Yield to wait for either a command to arrive, or the
-					block time to expire.  If a command arrived between the
-					critical section being exited and this yield then the yield
-					will not cause the task to block. */
-					portYIELD_WITHIN_API();
+					/* A task can't block on its notification with the
+					scheduler suspended. */
+					( void ) xTaskResumeAll();
+					prvCommandRingWait( pxLane, ( xWakeTime - xTimeNow ), xTimeNow, xListWasEmpty );
 				}
-				else
+				#else
 				{
-					mtCOVERAGE_TEST_MARKER();
+					vQueueWaitForMessageRestricted( pxLane->xTimerQueue, ( xWakeTime - xTimeNow ), xListWasEmpty );
+
+					if( xTaskResumeAll() == pdFALSE )
+					{
+						/* Yield to wait for either a command to arrive, or the
+						block time to expire.  If a command arrived between the
+						critical section being exited and this yield then the yield
+						will not cause the task to block. */
+						portYIELD_WITHIN_API();
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
 				}
+				#endif /* configUSE_TIMER_COMMAND_RING */
 			}
 		}
 		else
@@ -815,7 +1170,7 @@ BaseType_t xTimerListsWereSwitched;
 }
 /*-----------------------------------------------------------*/
 
-static TickType_t prvGetNextExpireTime( BaseType_t * const pxListWasEmpty )
+static TickType_t prvGetNextExpireTime( TimerLane_t * const pxLane, BaseType_t * const pxListWasEmpty )
 {
 TickType_t xNextExpireTime;
 
@@ -826,12 +1181,22 @@ TickType_t xNextExpireTime;
 	this task to unblock when the tick count overflows, at which point the
 	timer lists will be switched and the next expiry time can be
 	re-assessed.  */
-	*pxListWasEmpty = listLIST_IS_EMPTY( pxCurrentTimerList );
-	if( *pxListWasEmpty == pdFALSE )
+	#if( configUSE_TIMER_WHEEL == 1 )
 	{
-		xNextExpireTime = listGET_ITEM_VALUE_OF_HEAD_ENTRY( pxCurrentTimerList );
+		*pxListWasEmpty = ( prvTimerWheelGetNextTime( &( pxLane->xTimerWheel ), &xNextExpireTime ) == pdFALSE ) ? pdTRUE : pdFALSE;
 	}
-	else
+	#else
+	{
+		*pxListWasEmpty = listLIST_IS_EMPTY( pxLane->pxCurrentTimerList );
+
+		if( *pxListWasEmpty == pdFALSE )
+		{
+			xNextExpireTime = listGET_ITEM_VALUE_OF_HEAD_ENTRY( pxLane->pxCurrentTimerList );
+		}
+	}
+	#endif /* configUSE_TIMER_WHEEL */
+
+	if( *pxListWasEmpty != pdFALSE )
 	{
 		/* Ensure the task unblocks when the tick count rolls over. */
 		xNextExpireTime = ( TickType_t ) 0U;
@@ -841,16 +1206,15 @@ TickType_t xNextExpireTime;
 }
 /*-----------------------------------------------------------*/
 
-static TickType_t prvSampleTimeNow( BaseType_t * const pxTimerListsWereSwitched )
+static TickType_t prvSampleTimeNow( TimerLane_t * const pxLane, BaseType_t * const pxTimerListsWereSwitched )
 {
 TickType_t xTimeNow;
-PRIVILEGED_DATA static TickType_t xLastTime = ( TickType_t ) 0U; /*lint !e956 Variable is only accessible to one task. */
 
 	xTimeNow = xTaskGetTickCount();
 
-	if( xTimeNow < xLastTime )
+	if( xTimeNow < pxLane->xLastTime )
 	{
-		prvSwitchTimerLists();
+		prvSwitchTimerLists( pxLane );
 		*pxTimerListsWereSwitched = pdTRUE;
 	}
 	else
@@ -858,13 +1222,13 @@ PRIVILEGED_DATA static TickType_t xLastTime = ( TickType_t ) 0U; /*lint !e956 Va
 		*pxTimerListsWereSwitched = pdFALSE;
 	}
 
-	xLastTime = xTimeNow;
+	pxLane->xLastTime = xTimeNow;
 
 	return xTimeNow;
 }
 /*-----------------------------------------------------------*/
 
-static BaseType_t prvInsertTimerInActiveList( Timer_t * const pxTimer, const TickType_t xNextExpiryTime, const TickType_t xTimeNow, const TickType_t xCommandTime )
+static BaseType_t prvInsertTimerInActiveList( TimerLane_t * const pxLane, Timer_t * const pxTimer, const TickType_t xNextExpiryTime, const TickType_t xTimeNow, const TickType_t xCommandTime )
 {
 BaseType_t xProcessTimerNow = pdFALSE;
 
@@ -883,7 +1247,15 @@ BaseType_t xProcessTimerNow = pdFALSE;
 		}
 		else
 		{
-			vListInsert( pxOverflowTimerList, &( pxTimer->xTimerListItem ) );
+			#if( configUSE_TIMER_WHEEL == 1 )
+			{
+				vListInsertEnd( pxLane->pxOverflowTimerList, &( pxTimer->xTimerListItem ) );
+			}
+			#else
+			{
+				vListInsert( pxLane->pxOverflowTimerList, &( pxTimer->xTimerListItem ) );
+			}
+			#endif /* configUSE_TIMER_WHEEL */
 		}
 	}
 	else
@@ -897,7 +1269,15 @@ BaseType_t xProcessTimerNow = pdFALSE;
 		}
 		else
 		{
-			vListInsert( pxCurrentTimerList, &( pxTimer->xTimerListItem ) );
+			#if( configUSE_TIMER_WHEEL == 1 )
+			{
+				prvTimerWheelInsert( &( pxLane->xTimerWheel ), &( pxTimer->xTimerListItem ) );
+			}
+			#else
+			{
+				vListInsert( pxLane->pxCurrentTimerList, &( pxTimer->xTimerListItem ) );
+			}
+			#endif /* configUSE_TIMER_WHEEL */
 		}
 	}
 
@@ -907,23 +1287,21 @@ BaseType_t xProcessTimerNow = pdFALSE;
 
 /*-----------------------------------------------------------*/
 
-static void prvSwitchTimerLists( void )
+static void prvSwitchTimerLists( TimerLane_t * const pxLane )
 {
 TickType_t xNextExpireTime, xReloadTime;
-List_t *pxTemp;
 Timer_t *pxTimer;
-BaseType_t xResult;
+BaseType_t xResult, xListWasEmpty;
 
 	/* The tick count has overflowed.  The timer lists must be switched.
 	If there are any timers still referenced from the current timer list
 	then they must have expired and should be processed before the lists
 	are switched. */
-	while( listLIST_IS_EMPTY( pxCurrentTimerList ) == pdFALSE )
+	for( xNextExpireTime = prvGetNextExpireTime( pxLane, &xListWasEmpty ); xListWasEmpty == pdFALSE; xNextExpireTime = prvGetNextExpireTime( pxLane, &xListWasEmpty ) )
 	{
-		xNextExpireTime = listGET_ITEM_VALUE_OF_HEAD_ENTRY( pxCurrentTimerList );
+		pxTimer = prvGetExpiredTimer( pxLane, xNextExpireTime );
 
 		/* Remove the timer from the list. */
-		pxTimer = ( Timer_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxCurrentTimerList );
 		( void ) uxListRemove( &( pxTimer->xTimerListItem ) );
 		traceTIMER_EXPIRED( pxTimer );
 
@@ -947,7 +1325,16 @@ BaseType_t xResult;
 			{
 				listSET_LIST_ITEM_VALUE( &( pxTimer->xTimerListItem ), xReloadTime );
 				listSET_LIST_ITEM_OWNER( &( pxTimer->xTimerListItem ), pxTimer );
-				vListInsert( pxCurrentTimerList, &( pxTimer->xTimerListItem ) );
+
+				#if( configUSE_TIMER_WHEEL == 1 )
+				{
+					prvTimerWheelInsert( &( pxLane->xTimerWheel ), &( pxTimer->xTimerListItem ) );
+				}
+				#else
+				{
+					vListInsert( pxLane->pxCurrentTimerList, &( pxTimer->xTimerListItem ) );
+				}
+				#endif /* configUSE_TIMER_WHEEL */
 			}
 			else
 			{
@@ -962,61 +1349,605 @@ BaseType_t xResult;
 		}
 	}
 
-	pxTemp = pxCurrentTimerList;
-	pxCurrentTimerList = pxOverflowTimerList;
-	pxOverflowTimerList = pxTemp;
+	#if( configUSE_TIMER_WHEEL == 1 )
+	{
+	ListItem_t *pxItem;
+
+		/* The wheel is empty, it starts again from 0 with the timers that
+		waited for the overflow. */
+		pxLane->xTimerWheel.xTime = ( TickType_t ) 0U;
+
+		while( listLIST_IS_EMPTY( pxLane->pxOverflowTimerList ) == pdFALSE )
+		{
+			pxItem = listGET_HEAD_ENTRY( pxLane->pxOverflowTimerList );
+			( void ) uxListRemove( pxItem );
+			prvTimerWheelInsert( &( pxLane->xTimerWheel ), pxItem );
+		}
+	}
+	#else
+	{
+	List_t *pxTemp;
+
+		pxTemp = pxLane->pxCurrentTimerList;
+		pxLane->pxCurrentTimerList = pxLane->pxOverflowTimerList;
+		pxLane->pxOverflowTimerList = pxTemp;
+	}
+	#endif /* configUSE_TIMER_WHEEL */
 }
 /*-----------------------------------------------------------*/
 
+static Timer_t * prvGetExpiredTimer( TimerLane_t * const pxLane, const TickType_t xNextExpireTime )
+{
+Timer_t *pxTimer;
+
+	#if( configUSE_TIMER_WHEEL == 1 )
+	{
+		pxTimer = prvTimerWheelAdvance( &( pxLane->xTimerWheel ), xNextExpireTime );
+	}
+	#else
+	{
+		/* The head of the list expires first, at xNextExpireTime. */
+		( void ) xNextExpireTime;
+		pxTimer = ( Timer_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxLane->pxCurrentTimerList );
+	}
+	#endif /* configUSE_TIMER_WHEEL */
+
+	return pxTimer;
+}
+/*-----------------------------------------------------------*/
+
+#if( configUSE_TIMER_SLACK == 1 )
+
+	static TickType_t prvGetWakeTime( TimerLane_t * const pxLane )
+	{
+	TickType_t xWakeTime = portMAX_DELAY;
+	ListItem_t *pxItem;
+	const ListItem_t *pxEnd;
+
+		#if( configUSE_TIMER_WHEEL == 1 )
+		{
+		const TimerWheel_t * const pxWheel = &( pxLane->xTimerWheel );
+		UBaseType_t uxLevel, uxSlot, uxShift;
+		const List_t *pxSlot;
+
+			/* Slots are visited in expiry order, up to the first one starting
+			at or after the wake time. */
+			for( uxLevel = 0; uxLevel < tmrWHEEL_LEVELS; uxLevel++ )
+			{
+				uxShift = uxLevel * configTIMER_WHEEL_SLOT_BITS;
+				uxSlot = tmrWHEEL_DIGIT( pxWheel->xTime, uxLevel ) + ( ( uxLevel == 0U ) ? 0U : 1U );
+
+				for( ; uxSlot < tmrWHEEL_SLOTS; uxSlot++ )
+				{
+					if( ( ( ( ( pxWheel->xTime >> uxShift ) & ~tmrWHEEL_DIGIT_MASK ) | ( TickType_t ) uxSlot ) << uxShift ) >= xWakeTime )
+					{
+						return xWakeTime;
+					}
+
+					pxSlot = &( pxWheel->xSlots[ uxLevel ][ uxSlot ] );
+					pxEnd = listGET_END_MARKER( pxSlot );
+
+					for( pxItem = listGET_HEAD_ENTRY( pxSlot ); pxItem != pxEnd; pxItem = listGET_NEXT( pxItem ) )
+					{
+						prvLimitWakeTime( &xWakeTime, pxItem );
+					}
+				}
+			}
+		}
+		#else
+		{
+			/* The list is sorted, so the timers after the wake time can't
+			lower it. */
+			pxEnd = listGET_END_MARKER( pxLane->pxCurrentTimerList );
+
+			for( pxItem = listGET_HEAD_ENTRY( pxLane->pxCurrentTimerList ); ( pxItem != pxEnd ) && ( listGET_LIST_ITEM_VALUE( pxItem ) < xWakeTime ); pxItem = listGET_NEXT( pxItem ) )
+			{
+				prvLimitWakeTime( &xWakeTime, pxItem );
+			}
+		}
+		#endif /* configUSE_TIMER_WHEEL */
+
+		return xWakeTime;
+	}
+	/*-----------------------------------------------------------*/
+
+	static void prvLimitWakeTime( TickType_t * const pxWakeTime, const ListItem_t * const pxItem )
+	{
+	const TickType_t xExpiryTime = listGET_LIST_ITEM_VALUE( pxItem );
+	TickType_t xLatestTime = xExpiryTime + ( ( Timer_t * ) listGET_LIST_ITEM_OWNER( pxItem ) )->xSlackInTicks;
+
+		/* The slack can't reach past the overflow of the tick count. */
+		if( xLatestTime < xExpiryTime )
+		{
+			xLatestTime = portMAX_DELAY;
+		}
+
+		if( xLatestTime < *pxWakeTime )
+		{
+			*pxWakeTime = xLatestTime;
+		}
+	}
+
+#endif /* configUSE_TIMER_SLACK */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_TIMER_WHEEL == 1 )
+
+	static void prvTimerWheelInsert( TimerWheel_t * const pxWheel, ListItem_t * const pxItem )
+	{
+	const TickType_t xExpiryTime = listGET_LIST_ITEM_VALUE( pxItem );
+	TickType_t xDiffer = xExpiryTime ^ pxWheel->xTime;
+	UBaseType_t uxLevel = 0;
+
+		/* Find the highest digit the expiry time differs in.  The expiry time
+		is not before the time of the wheel, so its digit is the larger one. */
+		while( xDiffer > tmrWHEEL_DIGIT_MASK )
+		{
+			xDiffer >>= configTIMER_WHEEL_SLOT_BITS;
+			uxLevel++;
+		}
+
+		vListInsertEnd( &( pxWheel->xSlots[ uxLevel ][ tmrWHEEL_DIGIT( xExpiryTime, uxLevel ) ] ), pxItem );
+	}
+	/*-----------------------------------------------------------*/
+
+	static BaseType_t prvTimerWheelGetNextTime( const TimerWheel_t * const pxWheel, TickType_t * const pxNextTime )
+	{
+	UBaseType_t uxLevel, uxSlot;
+	const List_t *pxSlot;
+	ListItem_t *pxItem;
+	const ListItem_t *pxEnd;
+
+		/* Timers of a lower level expire before the timers of a higher level.
+		In level 0 a timer can expire at the time of the wheel, in higher
+		levels only the slots after the digit of the time are used. */
+		for( uxLevel = 0; uxLevel < tmrWHEEL_LEVELS; uxLevel++ )
+		{
+			uxSlot = tmrWHEEL_DIGIT( pxWheel->xTime, uxLevel ) + ( ( uxLevel == 0U ) ? 0U : 1U );
+
+			for( ; uxSlot < tmrWHEEL_SLOTS; uxSlot++ )
+			{
+				pxSlot = &( pxWheel->xSlots[ uxLevel ][ uxSlot ] );
+
+				if( listLIST_IS_EMPTY( pxSlot ) == pdFALSE )
+				{
+					/* All timers of a slot in level 0 expire at the same time.
+					A slot of a higher level is searched for the first expiry,
+					so the timer service task doesn't wake just to move the
+					timers down, which would be wasted on timers that are
+					reset before they expire. */
+					pxEnd = listGET_END_MARKER( pxSlot );
+					*pxNextTime = listGET_ITEM_VALUE_OF_HEAD_ENTRY( pxSlot );
+
+					for( pxItem = listGET_NEXT( listGET_HEAD_ENTRY( pxSlot ) ); pxItem != pxEnd; pxItem = listGET_NEXT( pxItem ) )
+					{
+						if( listGET_LIST_ITEM_VALUE( pxItem ) < *pxNextTime )
+						{
+							*pxNextTime = listGET_LIST_ITEM_VALUE( pxItem );
+						}
+					}
+
+					return pdTRUE;
+				}
+			}
+		}
+
+		return pdFALSE;
+	}
+	/*-----------------------------------------------------------*/
+
+	static Timer_t * prvTimerWheelAdvance( TimerWheel_t * const pxWheel, const TickType_t xTime )
+	{
+	TickType_t xDiffer = xTime ^ pxWheel->xTime;
+	UBaseType_t uxLevel = 0;
+	List_t *pxSlot;
+	ListItem_t *pxItem;
+
+		while( xDiffer > tmrWHEEL_DIGIT_MASK )
+		{
+			xDiffer >>= configTIMER_WHEEL_SLOT_BITS;
+			uxLevel++;
+		}
+
+		pxWheel->xTime = xTime;
+
+		/* No timer expires before xTime, so of the slots xTime enters only the
+		one of the highest changed digit can hold timers.  They are moved to
+		lower levels, each timer at most once per level. */
+		if( uxLevel > 0U )
+		{
+			pxSlot = &( pxWheel->xSlots[ uxLevel ][ tmrWHEEL_DIGIT( xTime, uxLevel ) ] );
+
+			while( listLIST_IS_EMPTY( pxSlot ) == pdFALSE )
+			{
+				pxItem = listGET_HEAD_ENTRY( pxSlot );
+				( void ) uxListRemove( pxItem );
+				prvTimerWheelInsert( pxWheel, pxItem );
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		/* xTime is the expiry time of the first timer, which is now in the
+		slot of level 0. */
+		pxSlot = &( pxWheel->xSlots[ 0 ][ tmrWHEEL_DIGIT( xTime, 0U ) ] );
+		configASSERT( listLIST_IS_EMPTY( pxSlot ) == pdFALSE );
+
+		return ( Timer_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxSlot );
+	}
+
+#endif /* configUSE_TIMER_WHEEL */
+/*-----------------------------------------------------------*/
+
 static void prvCheckForValidListAndQueue( void )
 {
-	/* Check that the list from which active timers are referenced, and the
-	queue used to communicate with the timer service, have been
+TimerLane_t *pxLane;
+UBaseType_t uxLane;
+
+	/* Check that the lists from which active timers are referenced, and the
+	queues used to communicate with the timer service tasks, have been
 	initialised. */
 	taskENTER_CRITICAL();
 	{
-		if( xTimerQueue == NULL )
+		for( uxLane = 0; uxLane < ( UBaseType_t ) configTIMER_SERVICE_LANES; uxLane++ )
 		{
-			vListInitialise( &xActiveTimerList1 );
-			vListInitialise( &xActiveTimerList2 );
-			pxCurrentTimerList = &xActiveTimerList1;
-			pxOverflowTimerList = &xActiveTimerList2;
+			pxLane = &( xTimerLanes[ uxLane ] );
 
-			#if( configSUPPORT_STATIC_ALLOCATION == 1 )
+			if( tmrCOMMAND_CHANNEL_IS_VALID( pxLane ) == pdFALSE )
 			{
-				/* The timer queue is allocated statically in case
-				configSUPPORT_DYNAMIC_ALLOCATION is 0. */
-				static StaticQueue_t xStaticTimerQueue; /*lint !e956 Ok to declare in this manner to prevent additional conditional compilation guards in other locations. */
-				static uint8_t ucStaticTimerQueueStorage[ ( size_t ) configTIMER_QUEUE_LENGTH * sizeof( DaemonTaskMessage_t ) ]; /*lint !e956 Ok to declare in this manner to prevent additional conditional compilation guards in other locations. */
+				#if( configUSE_TIMER_WHEEL == 1 )
+				{
+					for( UBaseType_t uxLevel = 0; uxLevel < tmrWHEEL_LEVELS; uxLevel++ )
+					{
+						for( UBaseType_t uxSlot = 0; uxSlot < tmrWHEEL_SLOTS; uxSlot++ )
+						{
+							vListInitialise( &( pxLane->xTimerWheel.xSlots[ uxLevel ][ uxSlot ] ) );
+						}
+					}
 
-				xTimerQueue = xQueueCreateStatic( ( UBaseType_t ) configTIMER_QUEUE_LENGTH, ( UBaseType_t ) sizeof( DaemonTaskMessage_t ), &( ucStaticTimerQueueStorage[ 0 ] ), &xStaticTimerQueue );
+					pxLane->xTimerWheel.xTime = ( TickType_t ) 0U;
+					vListInitialise( &( pxLane->xOverflowTimerList ) );
+					pxLane->pxOverflowTimerList = &( pxLane->xOverflowTimerList );
+				}
+				#else
+				{
+					vListInitialise( &( pxLane->xActiveTimerList1 ) );
+					vListInitialise( &( pxLane->xActiveTimerList2 ) );
+					pxLane->pxCurrentTimerList = &( pxLane->xActiveTimerList1 );
+					pxLane->pxOverflowTimerList = &( pxLane->xActiveTimerList2 );
+				}
+				#endif /* configUSE_TIMER_WHEEL */
+
+				#if( configUSE_TIMER_COMMAND_RING == 1 )
+				{
+					/* The ring is statically allocated and starts empty. */
+					mtCOVERAGE_TEST_MARKER();
+				}
+				#elif( configSUPPORT_STATIC_ALLOCATION == 1 )
+				{
+					/* The timer queues are allocated statically in case
+					configSUPPORT_DYNAMIC_ALLOCATION is 0. */
+					static StaticQueue_t xStaticTimerQueues[ configTIMER_SERVICE_LANES ]; /*lint !e956 Ok to declare in this manner to prevent additional conditional compilation guards in other locations. */
+					static uint8_t ucStaticTimerQueueStorage[ configTIMER_SERVICE_LANES ][ ( size_t ) configTIMER_QUEUE_LENGTH * sizeof( DaemonTaskMessage_t ) ]; /*lint !e956 Ok to declare in this manner to prevent additional conditional compilation guards in other locations. */
+
+					pxLane->xTimerQueue = xQueueCreateStatic( ( UBaseType_t ) configTIMER_QUEUE_LENGTH, ( UBaseType_t ) sizeof( DaemonTaskMessage_t ), &( ucStaticTimerQueueStorage[ uxLane ][ 0 ] ), &( xStaticTimerQueues[ uxLane ] ) );
+				}
+				#else
+				{
+					pxLane->xTimerQueue = xQueueCreate( ( UBaseType_t ) configTIMER_QUEUE_LENGTH, sizeof( DaemonTaskMessage_t ) );
+				}
+				#endif
+
+				#if ( ( configQUEUE_REGISTRY_SIZE > 0 ) && ( configUSE_TIMER_COMMAND_RING == 0 ) )
+				{
+					if( pxLane->xTimerQueue != NULL )
+					{
+						vQueueAddToRegistry( pxLane->xTimerQueue, "TmrQ" );
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				#endif /* configQUEUE_REGISTRY_SIZE */
 			}
-			#else
+			else
 			{
-				xTimerQueue = xQueueCreate( ( UBaseType_t ) configTIMER_QUEUE_LENGTH, sizeof( DaemonTaskMessage_t ) );
+				mtCOVERAGE_TEST_MARKER();
 			}
-			#endif
+		}
+	}
+	taskEXIT_CRITICAL();
+}
+/*-----------------------------------------------------------*/
+
+#if( configUSE_TIMER_COMMAND_RING == 1 )
+
+	static BaseType_t prvCommandRingPush( TimerLane_t * const pxLane, const DaemonTaskMessage_t * const pxMessage )
+	{
+	CommandRing_t * const pxRing = &( pxLane->xTimerCommandRing );
+	UBaseType_t uxSavedInterruptStatus, uxHead, uxNextHead;
+	BaseType_t xReturn;
+
+		/* Senders can interrupt each other, so a slot is claimed, filled and
+		published with interrupts masked.  Unlike a queue send this only copies
+		a few words, and never touches the lists of waiting tasks. */
+		uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+		{
+			uxHead = pxRing->uxHead;
+			uxNextHead = ( uxHead + ( UBaseType_t ) 1 ) % tmrCOMMAND_RING_SLOTS;
+
+			#if( configUSE_TIMER_COMMAND_COALESCING == 1 )
+				/* Merging is tried first, it works even if the ring is full. */
+				if( prvCommandRingCoalesce( pxLane, pxMessage ) != pdFALSE )
+				{
+					xReturn = tmrCOMMAND_RING_MERGED;
+				}
+				else
+			#endif /* configUSE_TIMER_COMMAND_COALESCING */
+			if( uxNextHead != pxRing->uxTail )
+			{
+				pxRing->xSlots[ uxHead ] = *pxMessage;
+
+				#if( configTIMER_SERVICE_LANES > 1 )
+				{
+					/* A merged command adds no slot, so only new ones are
+					counted.  Pended function calls have no timer. */
+					if( pxMessage->xMessageID >= ( BaseType_t ) 0 )
+					{
+						pxMessage->u.xTimerParameters.pxTimer->uxCommandsPending++;
+					}
+				}
+				#endif
+
+				/* The command must be in the slot before the timer service
+				task can see the slot. */
+				portMEMORY_BARRIER();
+				pxRing->uxHead = uxNextHead;
+				xReturn = pdPASS;
+			}
+			else
+			{
+				xReturn = errQUEUE_FULL;
+			}
+		}
+		portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+		return xReturn;
+	}
+	/*-----------------------------------------------------------*/
+
+	static BaseType_t prvCommandRingSend( TimerLane_t * const pxLane, const DaemonTaskMessage_t * const pxMessage, TickType_t xTicksToWait )
+	{
+	BaseType_t xReturn;
+
+		for( ;; )
+		{
+			xReturn = prvCommandRingPush( pxLane, pxMessage );
+
+			if( ( xReturn != errQUEUE_FULL ) || ( xTicksToWait == ( TickType_t ) 0 ) )
+			{
+				break;
+			}
+
+			/* No task waits on the ring, the sender looks for a free slot
+			again on the next tick. */
+			vTaskDelay( ( TickType_t ) 1 );
+
+			if( xTicksToWait != portMAX_DELAY )
+			{
+				xTicksToWait--;
+			}
+		}
+
+		/* Before the scheduler starts the timer service task doesn't exist,
+		it finds the commands in the ring when it runs for the first time.  A
+		merged command was already notified with the pending one. */
+		if( ( xReturn == pdPASS ) && ( pxLane->xTimerTaskHandle != NULL ) )
+		{
+			( void ) xTaskNotifyGive( pxLane->xTimerTaskHandle );
+		}
+		else if( xReturn == tmrCOMMAND_RING_MERGED )
+		{
+			xReturn = pdPASS;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		return xReturn;
+	}
+	/*-----------------------------------------------------------*/
+
+	static BaseType_t prvCommandRingSendFromISR( TimerLane_t * const pxLane, const DaemonTaskMessage_t * const pxMessage, BaseType_t * const pxHigherPriorityTaskWoken )
+	{
+	BaseType_t xReturn;
+
+		xReturn = prvCommandRingPush( pxLane, pxMessage );
+
+		if( ( xReturn == pdPASS ) && ( pxLane->xTimerTaskHandle != NULL ) )
+		{
+			vTaskNotifyGiveFromISR( pxLane->xTimerTaskHandle, pxHigherPriorityTaskWoken );
+		}
+		else if( xReturn == tmrCOMMAND_RING_MERGED )
+		{
+			xReturn = pdPASS;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		return xReturn;
+	}
+	/*-----------------------------------------------------------*/
+
+	static BaseType_t prvCommandRingReceive( TimerLane_t * const pxLane, DaemonTaskMessage_t * const pxMessage )
+	{
+	CommandRing_t * const pxRing = &( pxLane->xTimerCommandRing );
+	UBaseType_t uxTail = pxRing->uxTail;
+
+		/* The slot of the previous command is handed back to the senders only
+		now that the command was processed, until then the senders see it as
+		pending.  The command must be copied out before. */
+		if( pxLane->xCommandRingTailHeld != pdFALSE )
+		{
+			uxTail = ( uxTail + ( UBaseType_t ) 1 ) % tmrCOMMAND_RING_SLOTS;
+			portMEMORY_BARRIER();
+			pxRing->uxTail = uxTail;
+			pxLane->xCommandRingTailHeld = pdFALSE;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		/* The head is sampled once per batch.  All commands published up to
+		then are read without looking at the senders' index again. */
+		if( uxTail == pxLane->uxCommandBatchEnd )
+		{
+			pxLane->uxCommandBatchEnd = pxRing->uxHead;
 
-			#if ( configQUEUE_REGISTRY_SIZE > 0 )
+			if( uxTail == pxLane->uxCommandBatchEnd )
 			{
-				if( xTimerQueue != NULL )
+				return pdFAIL;
+			}
+		}
+
+		/* Senders don't change the command once it is held. */
+		pxLane->xCommandRingTailHeld = pdTRUE;
+		portMEMORY_BARRIER();
+		*pxMessage = pxRing->xSlots[ uxTail ];
+
+		return pdPASS;
+	}
+	/*-----------------------------------------------------------*/
+
+	#if( configUSE_TIMER_COMMAND_COALESCING == 1 )
+
+		static BaseType_t prvCommandRingCoalesce( TimerLane_t * const pxLane, const DaemonTaskMessage_t * const pxMessage )
+		{
+		CommandRing_t * const pxRing = &( pxLane->xTimerCommandRing );
+		const BaseType_t xCommandID = pxMessage->xMessageID;
+		const UBaseType_t uxTail = pxRing->uxTail;
+		const UBaseType_t uxHead = pxRing->uxHead;
+		UBaseType_t uxSlot, uxPendingCommands = 0;
+		DaemonTaskMessage_t *pxPending = NULL;
+		Timer_t *pxTimer;
+		BaseType_t xReturn = pdFALSE;
+
+			if( ( tmrIS_RESET_COMMAND( xCommandID ) == pdFALSE ) && ( tmrIS_RESUME_COMMAND( xCommandID ) == pdFALSE ) )
+			{
+				return pdFALSE;
+			}
+
+			/* Find the last pending command for the timer.  The ring holds at
+			most configTIMER_QUEUE_LENGTH commands, which bounds the time
+			interrupts are masked. */
+			pxTimer = pxMessage->u.xTimerParameters.pxTimer;
+
+			for( uxSlot = uxTail; uxSlot != uxHead; uxSlot = ( uxSlot + ( UBaseType_t ) 1 ) % tmrCOMMAND_RING_SLOTS )
+			{
+				if( ( pxRing->xSlots[ uxSlot ].xMessageID >= ( BaseType_t ) 0 ) &&
+					( pxRing->xSlots[ uxSlot ].u.xTimerParameters.pxTimer == pxTimer ) )
 				{
-					vQueueAddToRegistry( xTimerQueue, "TmrQ" );
+					/* Once the timer service task holds the command at the
+					tail it can be reading or processing it, so it is not
+					changed any more. */
+					if( ( uxSlot != uxTail ) || ( pxLane->xCommandRingTailHeld == pdFALSE ) )
+					{
+						pxPending = &( pxRing->xSlots[ uxSlot ] );
+					}
+					else
+					{
+						pxPending = NULL;
+					}
+
+					uxPendingCommands++;
+				}
+			}
+
+			if( pxPending != NULL )
+			{
+				if( ( tmrIS_RESET_COMMAND( xCommandID ) != pdFALSE ) && ( tmrIS_RESET_COMMAND( pxPending->xMessageID ) != pdFALSE ) )
+				{
+					/* Only the later reset matters, the pending one gets its
+					time. */
+					pxPending->u.xTimerParameters.xMessageValue = pxMessage->u.xTimerParameters.xMessageValue;
+					xReturn = pdTRUE;
+				}
+				else if( ( tmrIS_PAUSE_COMMAND( pxPending->xMessageID ) != pdFALSE ) &&
+						 ( uxPendingCommands == ( UBaseType_t ) 1 ) &&
+						 ( pxPending->u.xTimerParameters.xMessageValue == pxMessage->u.xTimerParameters.xMessageValue ) &&
+						 ( listIS_CONTAINED_WITHIN( NULL, &( pxTimer->xTimerListItem ) ) == pdFALSE ) )
+				{
+					/* A running timer paused and resumed at the same tick keeps
+					running as it was.  No other command for the timer is
+					pending that could stop it first. */
+					pxPending->xMessageID = tmrCOMMAND_NONE;
+					xReturn = pdTRUE;
 				}
 				else
 				{
 					mtCOVERAGE_TEST_MARKER();
 				}
 			}
-			#endif /* configQUEUE_REGISTRY_SIZE */
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			return xReturn;
+		}
+
+	#endif /* configUSE_TIMER_COMMAND_COALESCING */
+	/*-----------------------------------------------------------*/
+
+	static void prvCommandRingWait( TimerLane_t * const pxLane, const TickType_t xTicksToExpire, const TickType_t xTimeBefore, const BaseType_t xWaitIndefinitely )
+	{
+	TickType_t xTicksToWait, xTicksElapsed;
+
+		if( xWaitIndefinitely != pdFALSE )
+		{
+			xTicksToWait = portMAX_DELAY;
+		}
+		else
+		{
+			/* Ticks pended while the scheduler was suspended were processed
+			after the expire time was assessed. */
+			xTicksElapsed = xTaskGetTickCount() - xTimeBefore;
+
+			if( xTicksElapsed < xTicksToExpire )
+			{
+				xTicksToWait = xTicksToExpire - xTicksElapsed;
+			}
+			else
+			{
+				xTicksToWait = ( TickType_t ) 0;
+			}
+
+			/* portMAX_DELAY would block forever. */
+			if( xTicksToWait == portMAX_DELAY )
+			{
+				xTicksToWait--;
+			}
+		}
+
+		/* Commands sent before the scheduler started did not notify. */
+		if( ( xTicksToWait != ( TickType_t ) 0 ) && ( pxLane->xTimerCommandRing.uxHead == pxLane->xTimerCommandRing.uxTail ) )
+		{
+			( void ) ulTaskNotifyTake( pdTRUE, xTicksToWait );
 		}
 		else
 		{
 			mtCOVERAGE_TEST_MARKER();
 		}
 	}
-	taskEXIT_CRITICAL();
-}
+
+#endif /* configUSE_TIMER_COMMAND_RING */
 /*-----------------------------------------------------------*/
 
 BaseType_t xTimerIsTimerActive( TimerHandle_t xTimer )
@@ -1092,6 +2023,103 @@ Timer_t * const pxTimer = ( Timer_t * ) xTimer;
 }
 /*-----------------------------------------------------------*/
 
+#if( configUSE_TIMER_SLACK == 1 )
+
+	void vTimerSetSlack( TimerHandle_t xTimer, const TickType_t xSlackInTicks )
+	{
+	Timer_t * const pxTimer = ( Timer_t * ) xTimer;
+
+		configASSERT( xTimer );
+
+		/* Used the next time the timer service task blocks. */
+		taskENTER_CRITICAL();
+		{
+			pxTimer->xSlackInTicks = xSlackInTicks;
+		}
+		taskEXIT_CRITICAL();
+	}
+
+#endif /* configUSE_TIMER_SLACK */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_TIMER_SLACK == 1 )
+
+	TickType_t xTimerGetSlack( TimerHandle_t xTimer )
+	{
+	Timer_t * const pxTimer = ( Timer_t * ) xTimer;
+
+		configASSERT( xTimer );
+		return pxTimer->xSlackInTicks;
+	}
+
+#endif /* configUSE_TIMER_SLACK */
+/*-----------------------------------------------------------*/
+
+#if( configTIMER_SERVICE_LANES > 1 )
+
+	static void prvCountPendingCommands( Timer_t * const pxTimer, const BaseType_t xCommands )
+	{
+	UBaseType_t uxSavedInterruptStatus;
+
+		/* Commands are sent from tasks and interrupts. */
+		uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+		{
+			pxTimer->uxCommandsPending += ( UBaseType_t ) xCommands;
+		}
+		portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+	}
+
+#endif /* configTIMER_SERVICE_LANES */
+/*-----------------------------------------------------------*/
+
+#if( configTIMER_SERVICE_LANES > 1 )
+
+	void vTimerSetLane( TimerHandle_t xTimer, const UBaseType_t uxLane )
+	{
+	Timer_t * const pxTimer = ( Timer_t * ) xTimer;
+	BaseType_t xIsDormant;
+
+		configASSERT( xTimer );
+		configASSERT( uxLane < ( UBaseType_t ) configTIMER_SERVICE_LANES );
+
+		/* The lists of active timers of a lane are only accessed by its task,
+		so a timer can only be moved while it is in none of them.  A command
+		still pending in the old lane would be processed there, so it also
+		has to wait until the old lane processed all commands of the timer. */
+		taskENTER_CRITICAL();
+		{
+			xIsDormant = ( ( listIS_CONTAINED_WITHIN( NULL, &( pxTimer->xTimerListItem ) ) != pdFALSE ) &&
+						   ( pxTimer->uxCommandsPending == ( UBaseType_t ) 0U ) ) ? pdTRUE : pdFALSE;
+			configASSERT( xIsDormant );
+
+			if( xIsDormant != pdFALSE )
+			{
+				pxTimer->uxLane = uxLane;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		taskEXIT_CRITICAL();
+	}
+
+#endif /* configTIMER_SERVICE_LANES */
+/*-----------------------------------------------------------*/
+
+#if( configTIMER_SERVICE_LANES > 1 )
+
+	UBaseType_t uxTimerGetLane( TimerHandle_t xTimer )
+	{
+	Timer_t * const pxTimer = ( Timer_t * ) xTimer;
+
+		configASSERT( xTimer );
+		return pxTimer->uxLane;
+	}
+
+#endif /* configTIMER_SERVICE_LANES */
+/*-----------------------------------------------------------*/
+
 TaskHandle_t xTimerGetTaskHandle( const TimerHandle_t xTimer )
 {
 Timer_t * const pxTimer = ( Timer_t * ) xTimer;
@@ -1122,7 +2150,9 @@ TaskHandle_t xReturn;
 		xMessage.u.xCallbackParameters.pvParameter1 = pvParameter1;
 		xMessage.u.xCallbackParameters.ulParameter2 = ulParameter2;
 
-		xReturn = xQueueSendFromISR( xTimerQueue, &xMessage, pxHigherPriorityTaskWoken );
+		/* Pended functions are called by the daemon task, the task of lane
+		0. */
+		xReturn = tmrSEND_COMMAND_FROM_ISR( &( xTimerLanes[ 0 ] ), &xMessage, pxHigherPriorityTaskWoken );
 
 		tracePEND_FUNC_CALL_FROM_ISR( xFunctionToPend, pvParameter1, ulParameter2, xReturn );
 
@@ -1142,7 +2172,7 @@ TaskHandle_t xReturn;
 		/* This function can only be called after a timer has been created or
 		after the scheduler has been started because, until then, the timer
 		queue does not exist. */
-		configASSERT( xTimerQueue );
+		configASSERT( tmrCOMMAND_CHANNEL_IS_VALID( &( xTimerLanes[ 0 ] ) ) );
 
 		/* Complete the message with the function parameters and post it to the
 		daemon task. */
@@ -1151,7 +2181,7 @@ TaskHandle_t xReturn;
 		xMessage.u.xCallbackParameters.pvParameter1 = pvParameter1;
 		xMessage.u.xCallbackParameters.ulParameter2 = ulParameter2;
 
-		xReturn = xQueueSendToBack( xTimerQueue, &xMessage, xTicksToWait );
+		xReturn = tmrSEND_COMMAND( &( xTimerLanes[ 0 ] ), &xMessage, xTicksToWait );
 
 		tracePEND_FUNC_CALL( xFunctionToPend, pvParameter1, ulParameter2, xReturn );
 